@@ -0,0 +1,108 @@
+/**
+ * @file queue_wait_freertos.c
+ * @brief FreeRTOS task-notification backend of the blocking queue layer.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  prepare() registers the calling task, wait() takes the task notification
+ *  with the remaining timeout and notify() gives it. Because the
+ *  notification value latches, the token is not needed.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_wait_freertos.h"
+#include <stddef.h> /* for NULL */
+
+static uint32_t freertos_prepare(void *obj);
+static bool freertos_wait(void *obj, uint32_t token, uint32_t *timeout);
+static void freertos_notify(void *obj);
+
+const queue_wait_ops_t queue_wait_freertos_ops = {freertos_prepare, freertos_wait, freertos_notify};
+
+void queue_wait_freertos_init(queue_wait_freertos_t *f)
+{
+    if (f != NULL)
+    {
+        f->waiter = NULL;
+    }
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Register the calling task as the waiter of `obj`.
+ */
+static uint32_t freertos_prepare(void *obj)
+{
+    queue_wait_freertos_t *f = (queue_wait_freertos_t *)obj;
+
+    f->waiter = xTaskGetCurrentTaskHandle();
+
+    return 0U;
+}
+
+/**
+ * @brief Block on the task notification for at most `*timeout` ticks.
+ */
+static bool freertos_wait(void *obj, uint32_t token, uint32_t *timeout)
+{
+    bool woken = true;
+
+    (void)obj;
+    (void)token;
+    if (*timeout == QUEUE_WAIT_FOREVER)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+    else
+    {
+        TimeOut_t start;
+        TickType_t remaining = (TickType_t)*timeout;
+
+        vTaskSetTimeOutState(&start);
+        (void)ulTaskNotifyTake(pdTRUE, remaining);
+        if (xTaskCheckForTimeOut(&start, &remaining) != pdFALSE)
+        {
+            remaining = 0U;
+            woken = false;
+        }
+        *timeout = (uint32_t)remaining;
+    }
+
+    return woken;
+}
+
+/**
+ * @brief Notify the registered waiter, from task or interrupt context.
+ */
+static void freertos_notify(void *obj)
+{
+    const queue_wait_freertos_t *f = (const queue_wait_freertos_t *)obj;
+    TaskHandle_t waiter = f->waiter;
+
+    if (waiter == NULL)
+    {
+        /* nobody prepared to wait yet */
+    }
+    else if (QUEUE_WAIT_FREERTOS_IN_ISR())
+    {
+        BaseType_t higher_priority_woken = pdFALSE;
+
+        vTaskNotifyGiveFromISR(waiter, &higher_priority_woken);
+        portYIELD_FROM_ISR(higher_priority_woken);
+    }
+    else
+    {
+        (void)xTaskNotifyGive(waiter);
+    }
+}
+
+/** @} */ /* end of queue_internal group */
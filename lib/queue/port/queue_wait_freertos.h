@@ -0,0 +1,71 @@
+/**
+ * @file queue_wait_freertos.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      FreeRTOS task-notification backend of the blocking queue layer.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Each wait object remembers the task that last prepared to wait on it and
+ *  wakes it with a direct-to-task notification; a notification sent before
+ *  the task blocks stays pending, so no wake-up is lost. Timeouts are given
+ *  in RTOS ticks.
+ *
+ * @note
+ *  One waiting task per wait object (e.g. one consumer task on `not_empty`).
+ *  notify() may run in interrupt context; detection uses
+ *  @ref QUEUE_WAIT_FREERTOS_IN_ISR.
+ *
+ *  Add `port/queue_wait_freertos.c` to the firmware build together with the
+ *  FreeRTOS kernel; it is not part of the host `queue_lib` target.
+ */
+
+#ifndef QUEUE_WAIT_FREERTOS_H
+#define QUEUE_WAIT_FREERTOS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue_wait.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+/**
+ * @brief Returns non-zero when called from interrupt context.
+ *
+ * Defaults to the Cortex-M port's xPortIsInsideInterrupt(); override for
+ * ports without it.
+ */
+#ifndef QUEUE_WAIT_FREERTOS_IN_ISR
+#define QUEUE_WAIT_FREERTOS_IN_ISR() (xPortIsInsideInterrupt() != pdFALSE)
+#endif
+
+    /**
+     * @ingroup queue
+     * @brief FreeRTOS wait object.
+     */
+    typedef struct
+    {
+        volatile TaskHandle_t waiter; /**< Task blocked (or about to block) on this object. */
+    } queue_wait_freertos_t;
+
+    /** @brief Backend operations; wait objects are `queue_wait_freertos_t *`. */
+    extern const queue_wait_ops_t queue_wait_freertos_ops;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a FreeRTOS wait object.
+     *
+     * @param[out] f Wait object (ignored if NULL).
+     */
+    void queue_wait_freertos_init(queue_wait_freertos_t *f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_WAIT_FREERTOS_H */
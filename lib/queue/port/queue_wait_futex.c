@@ -0,0 +1,124 @@
+/**
+ * @file queue_wait_futex.c
+ * @brief Linux futex backend of the blocking queue layer.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  prepare() reads the event counter, notify() increments it and wakes all
+ *  waiters, wait() sleeps with FUTEX_WAIT only while the counter still holds
+ *  the token, so a notify between prepare() and wait() is never lost.
+ *
+ * @ingroup queue
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE /* syscall() */
+#endif
+
+#include "queue_wait_futex.h"
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <stddef.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#define FUTEX_NS_PER_MS 1000000L
+#define FUTEX_MS_PER_S  1000U
+
+static uint32_t futex_prepare(void *obj);
+static bool futex_wait(void *obj, uint32_t token, uint32_t *timeout);
+static void futex_notify(void *obj);
+static uint32_t futex_elapsed_ms(const struct timespec *start);
+
+const queue_wait_ops_t queue_wait_futex_ops = {futex_prepare, futex_wait, futex_notify};
+
+void queue_wait_futex_init(queue_wait_futex_t *f)
+{
+    if (f != NULL)
+    {
+        __atomic_store_n(&f->word, 0U, __ATOMIC_RELEASE);
+    }
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Token = current event counter.
+ */
+static uint32_t futex_prepare(void *obj)
+{
+    queue_wait_futex_t *f = (queue_wait_futex_t *)obj;
+
+    return __atomic_load_n(&f->word, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Sleep while the counter equals `token`, at most `*timeout` ms.
+ *
+ * @details The elapsed time is rounded up to whole milliseconds, so
+ *          spurious wake-ups always consume part of the timeout.
+ */
+static bool futex_wait(void *obj, uint32_t token, uint32_t *timeout)
+{
+    queue_wait_futex_t *f = (queue_wait_futex_t *)obj;
+    bool woken = true;
+
+    if (*timeout == QUEUE_WAIT_FOREVER)
+    {
+        (void)syscall(SYS_futex, &f->word, FUTEX_WAIT_PRIVATE, token, NULL, NULL, 0);
+    }
+    else
+    {
+        struct timespec start;
+        struct timespec rel;
+        long rc = 0;
+        uint32_t elapsed = 0U;
+
+        rel.tv_sec = (time_t)(*timeout / FUTEX_MS_PER_S);
+        rel.tv_nsec = (long)(*timeout % FUTEX_MS_PER_S) * FUTEX_NS_PER_MS;
+        (void)clock_gettime(CLOCK_MONOTONIC, &start);
+        rc = syscall(SYS_futex, &f->word, FUTEX_WAIT_PRIVATE, token, &rel, NULL, 0);
+        elapsed = futex_elapsed_ms(&start);
+
+        *timeout = (elapsed >= *timeout) ? 0U : (*timeout - elapsed);
+        woken = !((rc != 0) && (errno == ETIMEDOUT));
+    }
+
+    return woken;
+}
+
+/**
+ * @brief Advance the counter and wake every waiter.
+ */
+static void futex_notify(void *obj)
+{
+    queue_wait_futex_t *f = (queue_wait_futex_t *)obj;
+
+    (void)__atomic_fetch_add(&f->word, 1U, __ATOMIC_RELEASE);
+    (void)syscall(SYS_futex, &f->word, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+/**
+ * @brief Milliseconds since `start`, rounded up.
+ */
+static uint32_t futex_elapsed_ms(const struct timespec *start)
+{
+    struct timespec now;
+    int64_t ns = 0;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    ns = ((int64_t)(now.tv_sec - start->tv_sec) * 1000000000LL) + (int64_t)(now.tv_nsec - start->tv_nsec);
+
+    return (uint32_t)((ns + (FUTEX_NS_PER_MS - 1)) / FUTEX_NS_PER_MS);
+}
+
+/** @} */ /* end of queue_internal group */
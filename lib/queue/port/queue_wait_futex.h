@@ -0,0 +1,51 @@
+/**
+ * @file queue_wait_futex.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Linux futex backend of the blocking queue layer.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Each wait object is a 32-bit event counter used as a private futex word.
+ *  Timeouts are given in milliseconds (CLOCK_MONOTONIC). Any number of
+ *  threads may wait on the same object.
+ */
+
+#ifndef QUEUE_WAIT_FUTEX_H
+#define QUEUE_WAIT_FUTEX_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue_wait.h"
+#include <stdint.h>
+
+    /**
+     * @ingroup queue
+     * @brief Futex wait object.
+     */
+    typedef struct
+    {
+        uint32_t word; /**< Event counter, incremented by every notify. */
+    } queue_wait_futex_t;
+
+    /** @brief Backend operations; wait objects are `queue_wait_futex_t *`. */
+    extern const queue_wait_ops_t queue_wait_futex_ops;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a futex wait object.
+     *
+     * @param[out] f Wait object (ignored if NULL).
+     */
+    void queue_wait_futex_init(queue_wait_futex_t *f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_WAIT_FUTEX_H */
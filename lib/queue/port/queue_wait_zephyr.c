@@ -0,0 +1,90 @@
+/**
+ * @file queue_wait_zephyr.c
+ * @brief Zephyr k_poll signal backend of the blocking queue layer.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  prepare() resets the signal, wait() polls it with the remaining timeout
+ *  and notify() raises it, waking the thread polling the signal. Only one
+ *  thread may wait on an object, see queue_wait_zephyr.h.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_wait_zephyr.h"
+#include <stddef.h> /* for NULL */
+
+static uint32_t zephyr_prepare(void *obj);
+static bool zephyr_wait(void *obj, uint32_t token, uint32_t *timeout);
+static void zephyr_notify(void *obj);
+
+const queue_wait_ops_t queue_wait_zephyr_ops = {zephyr_prepare, zephyr_wait, zephyr_notify};
+
+void queue_wait_zephyr_init(queue_wait_zephyr_t *z)
+{
+    if (z != NULL)
+    {
+        k_poll_signal_init(&z->signal);
+    }
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Clear the signal before the queue is tested.
+ */
+static uint32_t zephyr_prepare(void *obj)
+{
+    queue_wait_zephyr_t *z = (queue_wait_zephyr_t *)obj;
+
+    k_poll_signal_reset(&z->signal);
+
+    return 0U;
+}
+
+/**
+ * @brief Poll the signal for at most `*timeout` ms.
+ */
+static bool zephyr_wait(void *obj, uint32_t token, uint32_t *timeout)
+{
+    queue_wait_zephyr_t *z = (queue_wait_zephyr_t *)obj;
+    struct k_poll_event event;
+    bool woken = true;
+
+    (void)token;
+    k_poll_event_init(&event, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &z->signal);
+    if (*timeout == QUEUE_WAIT_FOREVER)
+    {
+        (void)k_poll(&event, 1, K_FOREVER);
+    }
+    else
+    {
+        const uint32_t start = k_uptime_get_32();
+        const int rc = k_poll(&event, 1, K_MSEC(*timeout));
+        const uint32_t elapsed = k_uptime_get_32() - start;
+
+        *timeout = (elapsed >= *timeout) ? 0U : (*timeout - elapsed);
+        woken = (rc != -EAGAIN);
+    }
+
+    return woken;
+}
+
+/**
+ * @brief Raise the signal; callable from threads and ISRs.
+ */
+static void zephyr_notify(void *obj)
+{
+    queue_wait_zephyr_t *z = (queue_wait_zephyr_t *)obj;
+
+    (void)k_poll_signal_raise(&z->signal, 0);
+}
+
+/** @} */ /* end of queue_internal group */
@@ -0,0 +1,60 @@
+/**
+ * @file queue_wait_zephyr.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Zephyr k_poll signal backend of the blocking queue layer.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Each wait object is a `struct k_poll_signal`. A raised signal stays set
+ *  until the next prepare(), so a notify between the queue test and k_poll()
+ *  is not lost. Timeouts are given in milliseconds. Requires
+ *  `CONFIG_POLL=y`.
+ *
+ * @note
+ *  One waiting thread per wait object (e.g. one consumer thread on
+ *  `not_empty`): prepare() of a second waiter would clear a signal raised
+ *  for the first, and k_poll_signal_raise() wakes a single poller only.
+ *
+ *  Add `port/queue_wait_zephyr.c` to the application build; it is not part
+ *  of the host `queue_lib` target.
+ */
+
+#ifndef QUEUE_WAIT_ZEPHYR_H
+#define QUEUE_WAIT_ZEPHYR_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue_wait.h"
+#include <zephyr/kernel.h>
+
+    /**
+     * @ingroup queue
+     * @brief Zephyr wait object.
+     */
+    typedef struct
+    {
+        struct k_poll_signal signal; /**< Raised by notify(), reset by prepare(). */
+    } queue_wait_zephyr_t;
+
+    /** @brief Backend operations; wait objects are `queue_wait_zephyr_t *`. */
+    extern const queue_wait_ops_t queue_wait_zephyr_ops;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a Zephyr wait object.
+     *
+     * @param[out] z Wait object (ignored if NULL).
+     */
+    void queue_wait_zephyr_init(queue_wait_zephyr_t *z);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_WAIT_ZEPHYR_H */
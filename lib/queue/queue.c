@@ -6,17 +6,23 @@
  *
  * @details
  *  Provides deterministic enqueue/dequeue operations on a caller-supplied
- *  memory buffer. Implementation uses explicit byte-wise copying and avoids
- *  standard library dependencies to ensure predictable timing.
+ *  memory buffer. Elements are moved by an internal copy engine that selects
+ *  a size/alignment specific path (single byte, half-word, word-wide, byte
+ *  tail) and avoids standard library dependencies to ensure predictable timing.
  *
  *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
  *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
  *  Safe because data is not type-reinterpreted.
  *
+ *  MISRA Deviation: DV-QUEUE-002 (Rules 11.3, 11.4)
+ *  Controlled cast from `uint8_t*` to word pointers and from pointers to
+ *  `uintptr_t` for alignment checks inside the copy engine.
+ *
  * @ingroup queue
  */
 
 #include "queue.h"
+#include "queue_internal.h"
 #include <stddef.h> /* for NULL */
 
 /* PRIVATE macro controls linkage:
@@ -29,17 +35,71 @@
 #define PRIVATE static
 #endif
 
-/* Internal helper: byte-wise deterministic copy.
- * @note MISRA Deviation DV-QUEUE-001 applies here.
+/* Word types used by the copy engine. `may_alias` keeps word-wide access of
+ * arbitrary element types well-defined under strict aliasing rules. */
+#if defined(__GNUC__) || defined(__clang__)
+typedef uint32_t __attribute__((__may_alias__)) queue_word_t;
+typedef uint16_t __attribute__((__may_alias__)) queue_half_t;
+#else
+typedef uint32_t queue_word_t;
+typedef uint16_t queue_half_t;
+#endif
+
+#define QUEUE_WORD_SIZE (4U)
+#define QUEUE_WORD_MASK (QUEUE_WORD_SIZE - 1U)
+
+/* Internal helper: size/alignment dispatched deterministic copy.
+ * @note MISRA Deviations DV-QUEUE-001 and DV-QUEUE-002 apply here.
  *       Do not expose externally; tested via queue_push/queue_pop. */
-PRIVATE void copy_bytes(uint8_t *dst, const uint8_t *src, uint16_t size);
-static bool validate_init_arg(const queue_t *q, const void *buffer, uint16_t buffer_element_size, uint16_t queue_capacity);
+PRIVATE void copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t size);
+static void copy_words(uint8_t *dst, const uint8_t *src, uint32_t size);
+static void copy_byte_loop(uint8_t *dst, const uint8_t *src, uint32_t size);
+static void ring_write(queue_t *q, const uint8_t *src, queue_index_t n);
+static void ring_read(const queue_t *q, uint8_t *dst, queue_index_t n);
+static queue_index_t advance_index(const queue_t *q, queue_index_t index, queue_index_t n);
+static uint8_t *slot_address(const queue_t *q, queue_index_t index);
+
+#if QUEUE_CFG_STATS
+static void stats_on_push(queue_t *q, queue_index_t n);
+#define STATS_ON_PUSH(q, n)   stats_on_push((q), (n))
+#define STATS_ON_POP(q, n)    ((q)->stats.pops += (uint32_t)(n))
+#define STATS_ON_FULL(q)      ((q)->stats.full_rejections++)
+#define STATS_ON_EMPTY(q)     ((q)->stats.empty_misses++)
+#define STATS_ON_OVERWRITE(q) ((q)->stats.overwrites++)
+#define STATS_ON_COALESCE(q)  ((q)->stats.coalesced++)
+#else
+/* Instrumentation compiled out: no code, no data. */
+#define STATS_ON_PUSH(q, n)   ((void)0)
+#define STATS_ON_POP(q, n)    ((void)0)
+#define STATS_ON_FULL(q)      ((void)0)
+#define STATS_ON_EMPTY(q)     ((void)0)
+#define STATS_ON_OVERWRITE(q) ((void)0)
+#define STATS_ON_COALESCE(q)  ((void)0)
+#endif
+#if QUEUE_CFG_SNAPSHOT
+#define SNAPSHOT_ON_PUSH(q, n)  ((q)->push_seq += (uint32_t)(n))
+#define SNAPSHOT_ON_REWRITE(q) ((q)->rewrites++)
+#else
+#define SNAPSHOT_ON_PUSH(q, n)  ((void)0)
+#define SNAPSHOT_ON_REWRITE(q) ((void)0)
+#endif
+#if QUEUE_CFG_COPY_HOOK
+static void copy_in(const queue_t *q, uint8_t *slot, const uint8_t *src, uint32_t size);
+static void copy_out(const queue_t *q, uint8_t *dst, const uint8_t *slot, uint32_t size);
+#define COPY_IN(q, slot, src, size)  copy_in((q), (slot), (src), (size))
+#define COPY_OUT(q, dst, slot, size) copy_out((q), (dst), (slot), (size))
+#else
+/* No hooks compiled in: the copy engine is called directly. */
+#define COPY_IN(q, slot, src, size)  copy_bytes((slot), (src), (size))
+#define COPY_OUT(q, dst, slot, size) copy_bytes((dst), (slot), (size))
+#endif
+static bool validate_init_arg(const queue_t *q, const void *buffer, queue_index_t buffer_element_size, queue_index_t queue_capacity);
 
 /* -------------------------- */
 /* Queue API implementation  */
 /* -------------------------- */
 
-queue_status_t queue_init(queue_t *q, void *buffer, uint16_t buffer_element_size, uint16_t queue_capacity)
+queue_status_t queue_init(queue_t *q, void *buffer, queue_index_t buffer_element_size, queue_index_t queue_capacity)
 {
     queue_status_t ret_status = QUEUE_OK;
 
@@ -55,33 +115,163 @@ queue_status_t queue_init(queue_t *q, void *buffer, uint16_t buffer_element_size
         q->head = 0U;
         q->tail = 0U;
         q->count = 0U;
+        q->index_mask = 0U;
+#if QUEUE_CFG_COPY_HOOK
+        q->copy.copy_in = NULL;
+        q->copy.copy_out = NULL;
+        q->copy.ctx = NULL;
+#endif
+#if QUEUE_CFG_SNAPSHOT
+        q->push_seq = 0U;
+        q->rewrites = 0U;
+#endif
+#if QUEUE_CFG_STATS
+        (void)queue_reset_stats(q);
+#endif
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_init_pow2(queue_t *q, void *buffer, queue_index_t buffer_element_size, queue_index_t queue_capacity)
+{
+    queue_status_t ret_status = QUEUE_ERROR;
+
+    /* Power of two: exactly one bit set (0 is rejected by queue_init) */
+    if ((queue_capacity & (queue_index_t)(queue_capacity - 1U)) == 0U)
+    {
+        ret_status = queue_init(q, buffer, buffer_element_size, queue_capacity);
+    }
+    if (ret_status == QUEUE_OK)
+    {
+        q->index_mask = (queue_index_t)(queue_capacity - 1U);
+    }
+
+    return ret_status;
+}
+
+#if QUEUE_CFG_COPY_HOOK
+queue_status_t queue_init_ex(queue_t *q, void *buffer, const queue_init_config_t *cfg)
+{
+    queue_status_t ret_status = QUEUE_ERROR;
+
+    if (cfg != NULL)
+    {
+        ret_status = queue_init(q, buffer, cfg->buffer_element_size, cfg->queue_capacity);
+    }
+    if (ret_status == QUEUE_OK)
+    {
+        q->copy = cfg->copy;
     }
 
     return ret_status;
 }
+#endif
 
 queue_status_t queue_push(queue_t *q, const void *item)
 {
     queue_status_t ret_status = QUEUE_OK;
 
-    if ((q == NULL) || (item == NULL))
+    if (QUEUE_ARG_INVALID((q == NULL) || (item == NULL)))
     {
         ret_status = QUEUE_ERROR;
     }
     else if (q->count >= q->capacity)
     {
         ret_status = QUEUE_FULL;
+        STATS_ON_FULL(q);
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        COPY_IN(q, slot_address(q, q->tail), (const uint8_t *)item, q->buffer_element_size);
+
+        q->tail = advance_index(q, q->tail, 1U);
+        q->count = (queue_index_t)((uint32_t)q->count + 1U);
+        STATS_ON_PUSH(q, 1U);
+        SNAPSHOT_ON_PUSH(q, 1U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_push_overwrite(queue_t *q, const void *item, bool *overwritten)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (item == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
     }
     else
     {
+        const bool is_full = (q->count >= q->capacity);
+
+        if (is_full)
+        {
+            /* Drop the oldest element; its slot is the one at tail */
+            q->head = advance_index(q, q->head, 1U);
+            q->count = (queue_index_t)((uint32_t)q->count - 1U);
+            STATS_ON_OVERWRITE(q);
+        }
+
         /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
-        uint8_t *base = (uint8_t *)q->buffer;
-        const uint32_t offset = (uint32_t)q->tail * (uint32_t)q->buffer_element_size;
+        COPY_IN(q, slot_address(q, q->tail), (const uint8_t *)item, q->buffer_element_size);
+
+        q->tail = advance_index(q, q->tail, 1U);
+        q->count = (queue_index_t)((uint32_t)q->count + 1U);
+        STATS_ON_PUSH(q, 1U);
+        SNAPSHOT_ON_PUSH(q, 1U);
+
+        if (overwritten != NULL)
+        {
+            *overwritten = is_full;
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_push_coalesce(queue_t *q, const void *item, const queue_coalesce_t *policy, bool *coalesced)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (item == NULL) || (policy == NULL) || (policy->equal == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        bool merged = false;
 
-        copy_bytes(&base[offset], (const uint8_t *)item, q->buffer_element_size);
+        if (q->count > 0U)
+        {
+            /* tail − 1 modulo capacity: the newest element */
+            const queue_index_t newest = advance_index(q, q->tail, (queue_index_t)((uint32_t)q->capacity - 1U));
+            uint8_t *slot = slot_address(q, newest);
+
+            merged = policy->equal(slot, item);
+            if (merged && (policy->mode == QUEUE_COALESCE_REPLACE))
+            {
+                /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+                COPY_IN(q, slot, (const uint8_t *)item, q->buffer_element_size);
+                SNAPSHOT_ON_REWRITE(q);
+            }
+        }
+
+        if (merged)
+        {
+            STATS_ON_COALESCE(q);
+        }
+        else
+        {
+            ret_status = queue_push(q, item);
+        }
 
-        q->tail = (uint16_t)(((uint32_t)q->tail + 1U) % (uint32_t)q->capacity);
-        q->count = (uint16_t)((uint32_t)q->count + 1U);
+        if (coalesced != NULL)
+        {
+            *coalesced = merged;
+        }
     }
 
     return ret_status;
@@ -91,24 +281,23 @@ queue_status_t queue_pop(queue_t *q, void *item)
 {
     queue_status_t ret_status = QUEUE_OK;
 
-    if ((q == NULL) || (item == NULL))
+    if (QUEUE_ARG_INVALID((q == NULL) || (item == NULL)))
     {
         ret_status = QUEUE_ERROR;
     }
     else if (q->count == 0U)
     {
         ret_status = QUEUE_EMPTY;
+        STATS_ON_EMPTY(q);
     }
     else
     {
         /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
-        const uint8_t *base = (const uint8_t *)q->buffer;
-        const uint32_t offset = (uint32_t)q->head * (uint32_t)q->buffer_element_size;
+        COPY_OUT(q, (uint8_t *)item, slot_address(q, q->head), q->buffer_element_size);
 
-        copy_bytes((uint8_t *)item, &base[offset], q->buffer_element_size);
-
-        q->head = (uint16_t)(((uint32_t)q->head + 1U) % (uint32_t)q->capacity);
-        q->count = (uint16_t)((uint32_t)q->count - 1U);
+        q->head = advance_index(q, q->head, 1U);
+        q->count = (queue_index_t)((uint32_t)q->count - 1U);
+        STATS_ON_POP(q, 1U);
     }
 
     return ret_status;
@@ -116,7 +305,7 @@ queue_status_t queue_pop(queue_t *q, void *item)
 
 queue_status_t queue_peek(const queue_t *q, void *item)
 {
-    if ((q == NULL) || (item == NULL))
+    if (QUEUE_ARG_INVALID((q == NULL) || (item == NULL)))
     {
         return QUEUE_ERROR;
     }
@@ -124,14 +313,369 @@ queue_status_t queue_peek(const queue_t *q, void *item)
     {
         return QUEUE_EMPTY;
     }
-    const uint8_t *base = (const uint8_t *)q->buffer;
-    uint32_t offset = (uint32_t)q->head * q->buffer_element_size;
-
-    copy_bytes((uint8_t *)item, &base[offset], q->buffer_element_size);
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+    COPY_OUT(q, (uint8_t *)item, slot_address(q, q->head), q->buffer_element_size);
 
     return QUEUE_OK;
 }
 
+queue_status_t queue_peek_at(const queue_t *q, queue_index_t offset, void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (item == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (offset >= q->count)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        COPY_OUT(q, (uint8_t *)item, slot_address(q, advance_index(q, q->head, offset)), q->buffer_element_size);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_iter_init(queue_iter_t *it, const queue_t *q)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((it == NULL) || (q == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        it->queue = q;
+        it->index = q->head;
+        it->remaining = q->count;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_iter_next(queue_iter_t *it, const void **element)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((it == NULL) || (it->queue == NULL) || (element == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (it->remaining == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        *element = slot_address(it->queue, it->index);
+        it->index = advance_index(it->queue, it->index, 1U);
+        it->remaining = (queue_index_t)((uint32_t)it->remaining - 1U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_push_n(queue_t *q, const void *items, queue_index_t n, queue_index_t *pushed)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (items == NULL) || (pushed == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const queue_index_t free_slots = (queue_index_t)((uint32_t)q->capacity - (uint32_t)q->count);
+        const queue_index_t to_push = (n < free_slots) ? n : free_slots;
+
+        if ((n > 0U) && (to_push == 0U))
+        {
+            ret_status = QUEUE_FULL;
+            STATS_ON_FULL(q);
+        }
+        else
+        {
+            /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+            ring_write(q, (const uint8_t *)items, to_push);
+
+            q->tail = advance_index(q, q->tail, to_push);
+            q->count = (queue_index_t)((uint32_t)q->count + (uint32_t)to_push);
+            STATS_ON_PUSH(q, to_push);
+            SNAPSHOT_ON_PUSH(q, to_push);
+        }
+        *pushed = to_push;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_pop_n(queue_t *q, void *items, queue_index_t n, queue_index_t *popped)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (items == NULL) || (popped == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const queue_index_t to_pop = (n < q->count) ? n : q->count;
+
+        if ((n > 0U) && (to_pop == 0U))
+        {
+            ret_status = QUEUE_EMPTY;
+            STATS_ON_EMPTY(q);
+        }
+        else
+        {
+            /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+            ring_read(q, (uint8_t *)items, to_pop);
+
+            q->head = advance_index(q, q->head, to_pop);
+            q->count = (queue_index_t)((uint32_t)q->count - (uint32_t)to_pop);
+            STATS_ON_POP(q, to_pop);
+        }
+        *popped = to_pop;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_push_all(queue_t *q, const void *items, queue_index_t n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (items == NULL)) || (n > q->capacity))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (((uint32_t)q->capacity - (uint32_t)q->count) < (uint32_t)n)
+    {
+        ret_status = QUEUE_FULL;
+        STATS_ON_FULL(q);
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        ring_write(q, (const uint8_t *)items, n);
+
+        q->tail = advance_index(q, q->tail, n);
+        q->count = (queue_index_t)((uint32_t)q->count + (uint32_t)n);
+        STATS_ON_PUSH(q, n);
+        SNAPSHOT_ON_PUSH(q, n);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_pop_exact(queue_t *q, void *items, queue_index_t n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (items == NULL)) || (n > q->capacity))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count < n)
+    {
+        ret_status = QUEUE_EMPTY;
+        STATS_ON_EMPTY(q);
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        ring_read(q, (uint8_t *)items, n);
+
+        q->head = advance_index(q, q->head, n);
+        q->count = (queue_index_t)((uint32_t)q->count - (uint32_t)n);
+        STATS_ON_POP(q, n);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_reserve(queue_t *q, void **slot)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (slot == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count >= q->capacity)
+    {
+        ret_status = QUEUE_FULL;
+        STATS_ON_FULL(q);
+    }
+    else
+    {
+        *slot = slot_address(q, q->tail);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_commit(queue_t *q)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID(q == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count >= q->capacity)
+    {
+        ret_status = QUEUE_FULL;
+    }
+    else
+    {
+        q->tail = advance_index(q, q->tail, 1U);
+        q->count = (queue_index_t)((uint32_t)q->count + 1U);
+        STATS_ON_PUSH(q, 1U);
+        SNAPSHOT_ON_PUSH(q, 1U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_acquire(const queue_t *q, const void **slot)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (slot == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        *slot = slot_address(q, q->head);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_release(queue_t *q)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID(q == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        q->head = advance_index(q, q->head, 1U);
+        q->count = (queue_index_t)((uint32_t)q->count - 1U);
+        STATS_ON_POP(q, 1U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_read_span(const queue_t *q, const void **span, queue_index_t *n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (span == NULL) || (n == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const queue_index_t until_wrap = (queue_index_t)((uint32_t)q->capacity - (uint32_t)q->head);
+
+        *n = (q->count < until_wrap) ? q->count : until_wrap;
+        if (*n == 0U)
+        {
+            ret_status = QUEUE_EMPTY;
+        }
+        else
+        {
+            *span = slot_address(q, q->head);
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_write_span(const queue_t *q, void **span, queue_index_t *n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID((q == NULL) || (span == NULL) || (n == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const queue_index_t free_slots = (queue_index_t)((uint32_t)q->capacity - (uint32_t)q->count);
+        const queue_index_t until_wrap = (queue_index_t)((uint32_t)q->capacity - (uint32_t)q->tail);
+
+        *n = (free_slots < until_wrap) ? free_slots : until_wrap;
+        if (*n == 0U)
+        {
+            ret_status = QUEUE_FULL;
+        }
+        else
+        {
+            *span = slot_address(q, q->tail);
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_read_advance(queue_t *q, queue_index_t n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID(q == NULL) || (n > q->count))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        q->head = advance_index(q, q->head, n);
+        q->count = (queue_index_t)((uint32_t)q->count - (uint32_t)n);
+        STATS_ON_POP(q, n);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_write_advance(queue_t *q, queue_index_t n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (QUEUE_ARG_INVALID(q == NULL) || ((uint32_t)n > ((uint32_t)q->capacity - (uint32_t)q->count)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        q->tail = advance_index(q, q->tail, n);
+        q->count = (queue_index_t)((uint32_t)q->count + (uint32_t)n);
+        STATS_ON_PUSH(q, n);
+        SNAPSHOT_ON_PUSH(q, n);
+    }
+
+    return ret_status;
+}
+
+#if (QUEUE_CFG_INLINE_QUERIES == 0)
 bool queue_is_empty(const queue_t *q)
 {
     bool is_empty = true;
@@ -156,6 +700,71 @@ bool queue_is_full(const queue_t *q)
     return is_full;
 }
 
+queue_index_t queue_count(const queue_t *q)
+{
+    queue_index_t count = 0U;
+
+    if (q != NULL)
+    {
+        count = q->count;
+    }
+
+    return count;
+}
+
+queue_index_t queue_free_space(const queue_t *q)
+{
+    queue_index_t free_slots = 0U;
+
+    if (q != NULL)
+    {
+        free_slots = (queue_index_t)((uint32_t)q->capacity - (uint32_t)q->count);
+    }
+
+    return free_slots;
+}
+#endif /* QUEUE_CFG_INLINE_QUERIES == 0 */
+
+#if QUEUE_CFG_STATS
+queue_status_t queue_get_stats(const queue_t *q, queue_stats_t *stats)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (stats == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        *stats = q->stats;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_reset_stats(queue_t *q)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (q == NULL)
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        q->stats.high_water_mark = q->count;
+        q->stats.pushes = 0U;
+        q->stats.pops = 0U;
+        q->stats.full_rejections = 0U;
+        q->stats.empty_misses = 0U;
+        q->stats.overwrites = 0U;
+        q->stats.coalesced = 0U;
+    }
+
+    return ret_status;
+}
+#endif /* QUEUE_CFG_STATS */
+
 /* -------------------------- */
 /* Internal helper functions  */
 /* -------------------------- */
@@ -170,25 +779,82 @@ bool queue_is_full(const queue_t *q)
  */
 
 /**
- * @brief Deterministic byte-wise copy of memory.
+ * @brief Copy engine entry point for the other queue variants.
+ *
+ * @param[out] dst Destination buffer.
+ * @param[in]  src Source buffer.
+ * @param[in]  size Number of bytes to copy.
+ *
+ * @note Declared in queue_internal.h; forwards to copy_bytes().
+ */
+void queue_copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t size)
+{
+    copy_bytes(dst, src, size);
+}
+
+/**
+ * @brief Copy-in entry point for the queue_t extensions.
+ *
+ * @param[in]  q    Queue instance (copy-in hook).
+ * @param[out] slot Destination in the queue storage.
+ * @param[in]  src  Source bytes.
+ * @param[in]  size Number of bytes.
+ *
+ * @note Declared in queue_internal.h; forwards to COPY_IN.
+ */
+void queue_copy_in(const queue_t *q, uint8_t *slot, const uint8_t *src, uint32_t size)
+{
+#if !QUEUE_CFG_COPY_HOOK
+    (void)q;
+#endif
+    COPY_IN(q, slot, src, size);
+}
+
+/**
+ * @brief Deterministic copy of one element (or contiguous element block).
  *
  * @param[out] dst Destination buffer (non-NULL).
  * @param[in]  src Source buffer (non-NULL).
  * @param[in]  size Number of bytes to copy.
  *
  * @details
- *  Used internally by queue_push/queue_pop to copy arbitrary elements
- *  in a deterministic, type-agnostic way.
+ *  Used internally by queue_push/queue_pop/queue_peek to copy arbitrary
+ *  elements in a deterministic, type-agnostic way. The copy path is selected
+ *  from the element size and the alignment of both pointers:
+ *  - 1 byte: single byte move,
+ *  - 2 bytes, half-word aligned: single half-word move,
+ *  - word aligned: unrolled word moves for 4/8/16 bytes, word loop plus
+ *    byte tail for other sizes,
+ *  - otherwise: byte loop.
+ *
+ *  For a given element size and buffer alignment the executed path, and
+ *  therefore the execution time, is constant.
  *
- *  @note MISRA Deviation DV-QUEUE-001 applies.
+ *  @note MISRA Deviations DV-QUEUE-001 and DV-QUEUE-002 apply.
  */
-PRIVATE void copy_bytes(uint8_t *dst, const uint8_t *src, uint16_t size)
+PRIVATE void copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t size)
 {
-    if ((dst != NULL) && (src != NULL))
+    if (!QUEUE_ARG_INVALID((dst == NULL) || (src == NULL)))
     {
-        for (uint16_t i = 0U; i < size; i = (uint16_t)(i + 1U))
+        /* MISRA Deviation DV-QUEUE-002: pointer to integer for alignment check */
+        const uintptr_t alignment = (uintptr_t)dst | (uintptr_t)src;
+
+        if (size == 1U)
+        {
+            dst[0] = src[0];
+        }
+        else if ((size == 2U) && ((alignment & 1U) == 0U))
+        {
+            /* MISRA Deviation DV-QUEUE-002: controlled cast for half-word copy */
+            *(queue_half_t *)(void *)dst = *(const queue_half_t *)(const void *)src;
+        }
+        else if ((alignment & (uintptr_t)QUEUE_WORD_MASK) == 0U)
+        {
+            copy_words(dst, src, size);
+        }
+        else
         {
-            dst[i] = src[i];
+            copy_byte_loop(dst, src, size);
         }
     }
     else
@@ -197,6 +863,234 @@ PRIVATE void copy_bytes(uint8_t *dst, const uint8_t *src, uint16_t size)
     }
 }
 
+/**
+ * @brief Word-wide copy for word aligned buffers.
+ *
+ * @param[out] dst Word aligned destination buffer.
+ * @param[in]  src Word aligned source buffer.
+ * @param[in]  size Number of bytes to copy.
+ *
+ * @details
+ *  4, 8 and 16 byte elements are copied with unrolled word moves. Other sizes
+ *  use a word loop followed by a byte-wise copy of the remaining 0..3 bytes.
+ *
+ *  @note MISRA Deviation DV-QUEUE-002 applies.
+ */
+static void copy_words(uint8_t *dst, const uint8_t *src, uint32_t size)
+{
+    /* MISRA Deviation DV-QUEUE-002: controlled cast for word-wide copy */
+    queue_word_t *dst_w = (queue_word_t *)(void *)dst;
+    const queue_word_t *src_w = (const queue_word_t *)(const void *)src;
+
+    switch (size)
+    {
+    case 4U:
+        dst_w[0] = src_w[0];
+        break;
+    case 8U:
+        dst_w[0] = src_w[0];
+        dst_w[1] = src_w[1];
+        break;
+    case 16U:
+        dst_w[0] = src_w[0];
+        dst_w[1] = src_w[1];
+        dst_w[2] = src_w[2];
+        dst_w[3] = src_w[3];
+        break;
+    default:
+    {
+        const uint32_t words = size / QUEUE_WORD_SIZE;
+        const uint32_t tail_offset = words * QUEUE_WORD_SIZE;
+
+        for (uint32_t i = 0U; i < words; i++)
+        {
+            dst_w[i] = src_w[i];
+        }
+        copy_byte_loop(&dst[tail_offset], &src[tail_offset], size - tail_offset);
+        break;
+    }
+    }
+}
+
+/**
+ * @brief Plain byte loop used for unaligned buffers and word tails.
+ *
+ * @param[out] dst Destination buffer.
+ * @param[in]  src Source buffer.
+ * @param[in]  size Number of bytes to copy.
+ */
+static void copy_byte_loop(uint8_t *dst, const uint8_t *src, uint32_t size)
+{
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        dst[i] = src[i];
+    }
+}
+
+/**
+ * @brief Copy `n` consecutive elements into the ring starting at `tail`.
+ *
+ * @param[in,out] q   Queue instance (enough free space already checked).
+ * @param[in]     src Source array of `n` elements.
+ * @param[in]     n   Number of elements to copy.
+ *
+ * @details
+ *  The ring region is split at the end of the buffer, so at most two
+ *  contiguous block copies are performed. Indices are not updated.
+ */
+static void ring_write(queue_t *q, const uint8_t *src, queue_index_t n)
+{
+    const uint32_t element_size = (uint32_t)q->buffer_element_size;
+    const uint32_t until_wrap = (uint32_t)q->capacity - (uint32_t)q->tail;
+    const uint32_t first = ((uint32_t)n < until_wrap) ? (uint32_t)n : until_wrap;
+    const uint32_t first_bytes = first * element_size;
+
+    COPY_IN(q, slot_address(q, q->tail), src, first_bytes);
+    COPY_IN(q, slot_address(q, 0U), &src[first_bytes], ((uint32_t)n - first) * element_size);
+}
+
+/**
+ * @brief Copy `n` consecutive elements out of the ring starting at `head`.
+ *
+ * @param[in]  q   Queue instance (enough stored elements already checked).
+ * @param[out] dst Destination array for `n` elements.
+ * @param[in]  n   Number of elements to copy.
+ *
+ * @details
+ *  Counterpart of ring_write(): at most two contiguous block copies,
+ *  indices are not updated.
+ */
+static void ring_read(const queue_t *q, uint8_t *dst, queue_index_t n)
+{
+    const uint32_t element_size = (uint32_t)q->buffer_element_size;
+    const uint32_t until_wrap = (uint32_t)q->capacity - (uint32_t)q->head;
+    const uint32_t first = ((uint32_t)n < until_wrap) ? (uint32_t)n : until_wrap;
+    const uint32_t first_bytes = first * element_size;
+
+    COPY_OUT(q, dst, slot_address(q, q->head), first_bytes);
+    COPY_OUT(q, &dst[first_bytes], slot_address(q, 0U), ((uint32_t)n - first) * element_size);
+}
+
+#if QUEUE_CFG_COPY_HOOK
+/**
+ * @brief Move caller data into queue storage through the copy-in hook.
+ *
+ * @param[in]  q    Queue instance (hooks).
+ * @param[out] slot Destination in the queue storage.
+ * @param[in]  src  Caller data.
+ * @param[in]  size Number of bytes (0 — nothing to do, the hook is not called).
+ */
+static void copy_in(const queue_t *q, uint8_t *slot, const uint8_t *src, uint32_t size)
+{
+    if (q->copy.copy_in == NULL)
+    {
+        copy_bytes(slot, src, size);
+    }
+    else if (size > 0U)
+    {
+        q->copy.copy_in(q->copy.ctx, slot, src, size);
+    }
+    else
+    {
+        /* empty second segment of a block copy */
+    }
+}
+
+/**
+ * @brief Move queue storage into caller data through the copy-out hook.
+ *
+ * @param[in]  q    Queue instance (hooks).
+ * @param[out] dst  Caller buffer.
+ * @param[in]  slot Source in the queue storage.
+ * @param[in]  size Number of bytes (0 — nothing to do, the hook is not called).
+ */
+static void copy_out(const queue_t *q, uint8_t *dst, const uint8_t *slot, uint32_t size)
+{
+    if (q->copy.copy_out == NULL)
+    {
+        copy_bytes(dst, slot, size);
+    }
+    else if (size > 0U)
+    {
+        q->copy.copy_out(q->copy.ctx, dst, slot, size);
+    }
+    else
+    {
+        /* empty second segment of a block copy */
+    }
+}
+#endif
+
+/**
+ * @brief Advance a ring index by `n` positions without division.
+ *
+ * @param[in] q     Queue instance.
+ * @param[in] index Current index (< capacity).
+ * @param[in] n     Number of positions (<= capacity).
+ *
+ * @return Wrapped index (< capacity).
+ *
+ * @details
+ *  Queues initialized with queue_init_pow2() wrap with `index_mask`,
+ *  all other queues with a single conditional subtraction. The selected
+ *  path is fixed per queue instance, so timing stays constant. The
+ *  distance to the wrap point is compared first, so no intermediate value
+ *  exceeds the index range even with 32-bit indices.
+ */
+static queue_index_t advance_index(const queue_t *q, queue_index_t index, queue_index_t n)
+{
+    const uint32_t until_wrap = (uint32_t)q->capacity - (uint32_t)index;
+    uint32_t next = 0U;
+
+    if (q->index_mask != 0U)
+    {
+        next = ((uint32_t)index + (uint32_t)n) & (uint32_t)q->index_mask;
+    }
+    else if ((uint32_t)n >= until_wrap)
+    {
+        next = (uint32_t)n - until_wrap;
+    }
+    else
+    {
+        next = (uint32_t)index + (uint32_t)n;
+    }
+
+    return (queue_index_t)next;
+}
+
+/**
+ * @brief Address of the element slot at a ring index.
+ *
+ * @param[in] q     Queue instance.
+ * @param[in] index Ring index (< capacity).
+ *
+ * @return Pointer to the slot inside `buffer`.
+ */
+static uint8_t *slot_address(const queue_t *q, queue_index_t index)
+{
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise access */
+    uint8_t *base = (uint8_t *)q->buffer;
+
+    return &base[(uint32_t)index * (uint32_t)q->buffer_element_size];
+}
+
+#if QUEUE_CFG_STATS
+/**
+ * @brief Account `n` added elements and track the occupancy high-water mark.
+ *
+ * @param[in,out] q Queue instance (count already updated).
+ * @param[in]     n Number of elements added.
+ */
+static void stats_on_push(queue_t *q, queue_index_t n)
+{
+    q->stats.pushes += (uint32_t)n;
+    if (q->count > q->stats.high_water_mark)
+    {
+        q->stats.high_water_mark = q->count;
+    }
+}
+#endif /* QUEUE_CFG_STATS */
+
 /**
  * @brief Validate queue initialization parameters.
  *
@@ -208,7 +1102,7 @@ PRIVATE void copy_bytes(uint8_t *dst, const uint8_t *src, uint16_t size)
  * @return true  — invalid argument(s).
  * @return false — all parameters valid.
  */
-PRIVATE bool validate_init_arg(const queue_t *q, const void *buffer, uint16_t buffer_element_size, uint16_t queue_capacity)
+PRIVATE bool validate_init_arg(const queue_t *q, const void *buffer, queue_index_t buffer_element_size, queue_index_t queue_capacity)
 {
     bool invalid = false;
 
@@ -219,6 +1113,13 @@ PRIVATE bool validate_init_arg(const queue_t *q, const void *buffer, uint16_t bu
     {
         invalid = true;
     }
+#if (QUEUE_CFG_INDEX_BITS == 32)
+    /* byte offsets and copy lengths are computed in 32 bits */
+    else if ((uint32_t)queue_capacity > (0xFFFFFFFFU / (uint32_t)buffer_element_size))
+    {
+        invalid = true;
+    }
+#endif
 
     return invalid;
 }
@@ -22,14 +22,18 @@
  *  Controlled cast from `void*` to `uint8_t*` for raw byte-level copy operations.
  *  Safe and justified — no aliasing or type reinterpretation occurs.
  *
+ *  MISRA Deviation: DV-QUEUE-002 (Rules 11.3, 11.4)
+ *  Controlled word-wide access inside the copy engine for aligned buffers.
+ *
  * @note
  *  The caller is responsible for providing a buffer of at least
  *  (element_size × capacity) bytes, properly aligned for the stored element type.
  *
  * @note
- *  The internal helper `copy_bytes(uint8_t*, const uint8_t*, uint16_t)` is tested
+ *  The internal helper `copy_bytes(uint8_t*, const uint8_t*, uint32_t)` is tested
  *  indirectly via unit tests in the DV_QUEUE_001 suite, covering NULL pointers
- *  and boundary conditions.
+ *  and boundary conditions, and directly in the queue_copy suite covering
+ *  every size/alignment path of the copy engine.
  */
 
 #ifndef QUEUE_H
@@ -40,8 +44,10 @@ extern "C"
 {
 #endif
 
+#include "queue_config.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h> /* for NULL */
     /**
      * @defgroup queue Queue Module
      * @brief Deterministic FIFO queue for safety-critical embedded systems.
@@ -54,6 +60,18 @@ extern "C"
      * @{
      */
 
+/**
+ * @ingroup queue
+ * @brief Index / count / size type of `queue_t`, selected by @ref QUEUE_CFG_INDEX_BITS.
+ */
+#if (QUEUE_CFG_INDEX_BITS == 16)
+    typedef uint16_t queue_index_t;
+#elif (QUEUE_CFG_INDEX_BITS == 32)
+    typedef uint32_t queue_index_t;
+#else
+#error "QUEUE_CFG_INDEX_BITS must be 16 or 32"
+#endif
+
     /**
      * @ingroup queue
      * @brief Queue operation status codes.
@@ -66,6 +84,121 @@ extern "C"
         QUEUE_ERROR = 3U  /**< General error — invalid parameters. */
     } queue_status_t;
 
+#if QUEUE_CFG_STATS
+    /**
+     * @ingroup queue
+     * @brief Queue occupancy and traffic statistics (QUEUE_CFG_STATS = 1).
+     *
+     * @note Counters wrap around at 2^32.
+     */
+    typedef struct
+    {
+        queue_index_t high_water_mark; /**< Highest `count` observed since init / reset. */
+        uint32_t pushes;               /**< Elements added (all push/commit variants). */
+        uint32_t pops;                 /**< Elements removed (all pop/release variants). */
+        uint32_t full_rejections;      /**< Push/reserve attempts rejected with QUEUE_FULL. */
+        uint32_t empty_misses;         /**< Pop attempts rejected with QUEUE_EMPTY. */
+        uint32_t overwrites;           /**< Elements dropped by queue_push_overwrite(). */
+        uint32_t coalesced;            /**< Pushes merged or dropped by queue_push_coalesce(). */
+    } queue_stats_t;
+#endif
+
+    /**
+     * @ingroup queue
+     * @brief Equivalence test used by queue_push_coalesce().
+     *
+     * @param[in] queued Newest stored element.
+     * @param[in] item   Element being pushed.
+     *
+     * @return true if `item` may be coalesced with `queued`.
+     */
+    typedef bool (*queue_equal_fn_t)(const void *queued, const void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Clock hook: current time in free-running ticks (wraps at 2^32).
+     *
+     * @details Used by the layers that sample time (queue_timed.h, queue_trace.h).
+     */
+    typedef uint32_t (*queue_clock_fn_t)(void *ctx);
+
+    /**
+     * @ingroup queue
+     * @brief What queue_push_coalesce() does with an equivalent element.
+     */
+    typedef enum
+    {
+        QUEUE_COALESCE_REPLACE = 0U, /**< Overwrite the newest element in place. */
+        QUEUE_COALESCE_DROP = 1U     /**< Keep the newest element, discard the new one. */
+    } queue_coalesce_mode_t;
+
+    /**
+     * @ingroup queue
+     * @brief Coalescing policy passed to queue_push_coalesce().
+     */
+    typedef struct
+    {
+        queue_equal_fn_t equal;     /**< Equivalence test (non-NULL). */
+        queue_coalesce_mode_t mode; /**< Action taken on an equivalent element. */
+    } queue_coalesce_t;
+
+#if QUEUE_CFG_COPY_HOOK
+    /**
+     * @ingroup queue
+     * @brief Element copy hook.
+     *
+     * @param[in]  ctx  User context from @ref queue_copy_ops_t.
+     * @param[out] dst  Destination.
+     * @param[in]  src  Source.
+     * @param[in]  size Bytes to copy: one or more whole elements, never 0.
+     *
+     * @note Must complete the copy before returning; it runs inside the
+     *       queue operation and must follow the same context rules.
+     *
+     * @warning A hook must leave the bytes unchanged: after `copy_in` the
+     *          storage holds exactly the caller's element, and `copy_out`
+     *          returns exactly the stored bytes. The hooks decide how the
+     *          bytes move (DMA, cache maintenance, non-temporal stores), not
+     *          what they are. Several paths access the storage directly and
+     *          rely on this:
+     *          - queue_iter_next(), queue_acquire() and queue_read_span() hand
+     *            out pointers to stored elements;
+     *          - queue_reserve() and queue_write_span() let the caller write
+     *            the storage in place;
+     *          - queue_find(), queue_count_if() and queue_remove_if() compare
+     *            keys in the storage; queue_remove_if() then moves the kept
+     *            elements through `copy_in` with the storage as source;
+     *          - the queue_push_coalesce() comparator receives a pointer to the
+     *            stored element;
+     *          - queue_snapshot_full() / queue_snapshot_delta() export stored
+     *            bytes, which queue_snapshot_restore() pushes back through
+     *            `copy_in`.
+     */
+    typedef void (*queue_copy_fn_t)(void *ctx, void *dst, const void *src, uint32_t size);
+
+    /**
+     * @ingroup queue
+     * @brief Per-queue copy hooks (QUEUE_CFG_COPY_HOOK = 1).
+     */
+    typedef struct
+    {
+        queue_copy_fn_t copy_in;  /**< Data → queue storage (push variants, queue_remove_if()); NULL — copy engine. */
+        queue_copy_fn_t copy_out; /**< Queue storage → caller data (pop/peek variants); NULL — copy engine. */
+        void *ctx;                /**< Passed to both hooks. */
+    } queue_copy_ops_t;
+
+    /**
+     * @ingroup queue
+     * @brief Geometry and copy hooks passed to queue_init_ex().
+     */
+    typedef struct
+    {
+        queue_index_t buffer_element_size; /**< Element size in bytes (> 0). */
+        queue_index_t queue_capacity;      /**< Number of elements (> 0). */
+        queue_copy_ops_t copy;             /**< Copy hooks of the queue. */
+    } queue_init_config_t;
+#endif
+
     /**
      * @ingroup queue
      * @brief FIFO queue control structure.
@@ -80,14 +213,39 @@ extern "C"
      */
     typedef struct
     {
-        void *buffer;                 /**< Pointer to user-provided data buffer. */
-        uint16_t buffer_element_size; /**< Element size in bytes (> 0). */
-        uint16_t capacity;            /**< Maximum number of elements (> 0). */
-        uint16_t head;                /**< Read index. */
-        uint16_t tail;                /**< Write index. */
-        uint16_t count;               /**< Current number of stored elements. */
+        void *buffer;                      /**< Pointer to user-provided data buffer. */
+        queue_index_t buffer_element_size; /**< Element size in bytes (> 0). */
+        queue_index_t capacity;            /**< Maximum number of elements (> 0). */
+        queue_index_t head;                /**< Read index. */
+        queue_index_t tail;                /**< Write index. */
+        queue_index_t count;               /**< Current number of stored elements. */
+        queue_index_t index_mask;          /**< capacity − 1 for power-of-two queues (queue_init_pow2()), 0 otherwise. */
+#if QUEUE_CFG_SNAPSHOT
+        uint32_t push_seq; /**< Elements pushed since init, wrapping at 2^32 (QUEUE_CFG_SNAPSHOT = 1). */
+        uint32_t rewrites; /**< In-place / out-of-order changes since init (QUEUE_CFG_SNAPSHOT = 1). */
+#endif
+#if QUEUE_CFG_STATS
+        queue_stats_t stats; /**< Instrumentation counters (QUEUE_CFG_STATS = 1). */
+#endif
+#if QUEUE_CFG_COPY_HOOK
+        queue_copy_ops_t copy; /**< Element copy hooks (QUEUE_CFG_COPY_HOOK = 1). */
+#endif
     } queue_t;
 
+    /**
+     * @ingroup queue
+     * @brief Read-only cursor over the stored elements, oldest first.
+     *
+     * @details Set up by queue_iter_init(); valid while no element it has not
+     *          yet visited is popped. Pushes do not affect the visit range.
+     */
+    typedef struct
+    {
+        const queue_t *queue;    /**< Queue being scanned. */
+        queue_index_t index;     /**< Physical slot of the next element. */
+        queue_index_t remaining; /**< Elements not yet visited. */
+    } queue_iter_t;
+
     /**
      * @ingroup queue
      * @brief Initialize a queue instance.
@@ -102,7 +260,53 @@ extern "C"
      *
      * @note Deterministic and reentrant.
      */
-    queue_status_t queue_init(queue_t *q, void *buffer, uint16_t buffer_element_size, uint16_t queue_capacity);
+    queue_status_t queue_init(queue_t *q, void *buffer, queue_index_t buffer_element_size, queue_index_t queue_capacity);
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a queue instance with a power-of-two capacity.
+     *
+     * @param[in,out] q            Pointer to queue control structure.
+     * @param[in]     buffer       Pointer to caller-supplied storage buffer.
+     * @param[in]     buffer_element_size Element size in bytes (must > 0).
+     * @param[in]     queue_capacity Number of elements in queue (power of two).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments (NULL, 0 or capacity not a power of two).
+     *
+     * @details
+     *  Indices of such a queue wrap with a bit mask instead of a compare and
+     *  subtract. Queues created with queue_init() never divide either — they
+     *  wrap with a single conditional subtraction.
+     *
+     * @note Deterministic and reentrant.
+     */
+    queue_status_t queue_init_pow2(queue_t *q, void *buffer, queue_index_t buffer_element_size, queue_index_t queue_capacity);
+
+#if QUEUE_CFG_COPY_HOOK
+    /**
+     * @ingroup queue
+     * @brief Initialize a queue instance with its own element copy hooks.
+     *
+     * @param[in,out] q      Pointer to queue control structure.
+     * @param[in]     buffer Pointer to caller-supplied storage buffer.
+     * @param[in]     cfg    Element size, capacity and copy hooks (copied).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments (NULL or 0).
+     *
+     * @details
+     *  Every element moved by a push, pop or peek variant goes through
+     *  `cfg->copy`, so DMA-coherent or otherwise special storage can be
+     *  handled without changing the queue code. queue_init() and
+     *  queue_init_pow2() install the built-in copy engine for both
+     *  directions.
+     *
+     * @note The hooks must not transform the data; see @ref queue_copy_fn_t
+     *       for the paths that read or write the storage directly.
+     */
+    queue_status_t queue_init_ex(queue_t *q, void *buffer, const queue_init_config_t *cfg);
+#endif
 
     /**
      * @ingroup queue
@@ -119,6 +323,53 @@ extern "C"
      */
     queue_status_t queue_push(queue_t *q, const void *item);
 
+    /**
+     * @ingroup queue
+     * @brief Push one element, dropping the oldest element if the queue is full.
+     *
+     * @param[in,out] q           Pointer to queue instance.
+     * @param[in]     item        Pointer to element data to add.
+     * @param[out]    overwritten Optional (may be NULL): set to true if the
+     *                            oldest element was dropped to make room.
+     *
+     * @retval QUEUE_OK    Success (element always added).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @details
+     *  Lossy-ring behavior for telemetry/log queues: on a full queue `head`
+     *  is advanced by one and the new element is written in its slot, so
+     *  the queue always holds the newest `capacity` elements.
+     *
+     * @note Deterministic, O(1) index update plus one element copy.
+     */
+    queue_status_t queue_push_overwrite(queue_t *q, const void *item, bool *overwritten);
+
+    /**
+     * @ingroup queue
+     * @brief Push one element unless it coalesces with the newest stored one.
+     *
+     * @param[in,out] q         Pointer to queue instance.
+     * @param[in]     item      Pointer to element data to add.
+     * @param[in]     policy    Equivalence test and coalescing mode.
+     * @param[out]    coalesced Optional (may be NULL): set to true if `item`
+     *                          was merged into or dropped at the newest element.
+     *
+     * @retval QUEUE_OK    Element added or coalesced.
+     * @retval QUEUE_FULL  Queue full and `item` not equivalent to the newest element.
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @details
+     *  Only the newest element (the one before `tail`) is compared, so a burst
+     *  of identical updates occupies one slot while FIFO order of distinct
+     *  events is kept. With QUEUE_COALESCE_REPLACE the newest element is
+     *  overwritten by `item`; with QUEUE_COALESCE_DROP `item` is discarded.
+     *  Coalescing succeeds on a full queue. A coalesced item does not count as
+     *  a push in the statistics.
+     *
+     * @note Deterministic, one comparator call plus at most one element copy.
+     */
+    queue_status_t queue_push_coalesce(queue_t *q, const void *item, const queue_coalesce_t *policy, bool *coalesced);
+
     /**
      * @ingroup queue
      * @brief Pop (dequeue) one element from the queue.
@@ -149,6 +400,291 @@ extern "C"
      */
     queue_status_t queue_peek(const queue_t *q, void *item);
 
+    /**
+     * @ingroup queue
+     * @brief Copy the element at a logical position without removing it.
+     *
+     * @param[in]  q      Pointer to queue instance.
+     * @param[in]  offset Position counted from the oldest element (0 = head).
+     * @param[out] item   Pointer to destination buffer to store element.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_EMPTY Fewer than `offset` + 1 elements stored (item unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic, O(1); queue_peek_at(q, 0U, item) equals queue_peek().
+     */
+    queue_status_t queue_peek_at(const queue_t *q, queue_index_t offset, void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Start an in-place scan of the stored elements.
+     *
+     * @param[out] it Iterator to set up.
+     * @param[in]  q  Pointer to queue instance.
+     *
+     * @retval QUEUE_OK    Iterator positioned at the oldest element.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_iter_init(queue_iter_t *it, const queue_t *q);
+
+    /**
+     * @ingroup queue
+     * @brief Hand out the next element of a scan and step past it.
+     *
+     * @param[in,out] it      Iterator set up by queue_iter_init().
+     * @param[out]    element Pointer into the queue buffer (valid until the
+     *                        element is popped); unchanged at the end of the scan.
+     *
+     * @retval QUEUE_OK    `*element` points to the next element.
+     * @retval QUEUE_EMPTY All elements visited.
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Zero-copy; follows the ring across the wrap point.
+     */
+    queue_status_t queue_iter_next(queue_iter_t *it, const void **element);
+
+    /**
+     * @ingroup queue
+     * @brief Push (enqueue) up to `n` elements in one call.
+     *
+     * @param[in,out] q      Pointer to queue instance.
+     * @param[in]     items  Pointer to an array of `n` elements.
+     * @param[in]     n      Number of elements to add.
+     * @param[out]    pushed Number of elements actually added (0..n).
+     *
+     * @retval QUEUE_OK    `*pushed` elements added (may be less than `n` if free space ran out).
+     * @retval QUEUE_FULL  Queue already full and `n` > 0 — nothing added.
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic; no blocking. Data is moved in at most two contiguous
+     *       copies (before and after the wrap point).
+     */
+    queue_status_t queue_push_n(queue_t *q, const void *items, queue_index_t n, queue_index_t *pushed);
+
+    /**
+     * @ingroup queue
+     * @brief Pop (dequeue) up to `n` elements in one call.
+     *
+     * @param[in,out] q      Pointer to queue instance.
+     * @param[out]    items  Pointer to destination array for up to `n` elements.
+     * @param[in]     n      Maximum number of elements to remove.
+     * @param[out]    popped Number of elements actually removed (0..n).
+     *
+     * @retval QUEUE_OK    `*popped` elements removed (may be less than `n` if the queue ran empty).
+     * @retval QUEUE_EMPTY Queue empty and `n` > 0 — nothing removed (items unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic; no blocking. Data is moved in at most two contiguous
+     *       copies (before and after the wrap point).
+     */
+    queue_status_t queue_pop_n(queue_t *q, void *items, queue_index_t n, queue_index_t *popped);
+
+    /**
+     * @ingroup queue
+     * @brief Push exactly `n` elements or none (e.g. one multi-element frame).
+     *
+     * @param[in,out] q     Pointer to queue instance.
+     * @param[in]     items Pointer to an array of `n` elements.
+     * @param[in]     n     Number of elements to add (<= capacity).
+     *
+     * @retval QUEUE_OK    All `n` elements added.
+     * @retval QUEUE_FULL  Fewer than `n` free slots — nothing added.
+     * @retval QUEUE_ERROR Invalid parameters or `n` > capacity.
+     *
+     * @note Free space is checked once; head/tail/count are updated once, so
+     *       a reader never observes part of the frame.
+     */
+    queue_status_t queue_push_all(queue_t *q, const void *items, queue_index_t n);
+
+    /**
+     * @ingroup queue
+     * @brief Pop exactly `n` elements or none.
+     *
+     * @param[in,out] q     Pointer to queue instance.
+     * @param[out]    items Destination array of `n` elements.
+     * @param[in]     n     Number of elements to remove (<= capacity).
+     *
+     * @retval QUEUE_OK    All `n` elements removed.
+     * @retval QUEUE_EMPTY Fewer than `n` elements stored — nothing removed.
+     * @retval QUEUE_ERROR Invalid parameters or `n` > capacity.
+     */
+    queue_status_t queue_pop_exact(queue_t *q, void *items, queue_index_t n);
+
+    /**
+     * @ingroup queue
+     * @brief Reserve the next free slot for in-place element construction.
+     *
+     * @param[in,out] q    Pointer to queue instance.
+     * @param[out]    slot Receives a pointer to the slot at `tail` inside `buffer`.
+     *
+     * @retval QUEUE_OK    Slot reserved, `*slot` valid until queue_commit().
+     * @retval QUEUE_FULL  Queue already full (`*slot` unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @details
+     *  The caller writes the element directly into `*slot` and publishes it
+     *  with queue_commit(). Nothing is visible to the consumer before commit.
+     *
+     * @note Deterministic; no copy. Only one reservation may be outstanding.
+     */
+    queue_status_t queue_reserve(queue_t *q, void **slot);
+
+    /**
+     * @ingroup queue
+     * @brief Commit the slot obtained with queue_reserve().
+     *
+     * @param[in,out] q Pointer to queue instance.
+     *
+     * @retval QUEUE_OK    Element published at `tail`.
+     * @retval QUEUE_FULL  No free slot (commit without successful reserve).
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_commit(queue_t *q);
+
+    /**
+     * @ingroup queue
+     * @brief Acquire a pointer to the oldest element for in-place processing.
+     *
+     * @param[in]  q    Pointer to queue instance.
+     * @param[out] slot Receives a pointer to the element at `head` inside `buffer`.
+     *
+     * @retval QUEUE_OK    Element available, `*slot` valid until queue_release().
+     * @retval QUEUE_EMPTY Queue empty (`*slot` unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic; no copy; queue state unchanged.
+     */
+    queue_status_t queue_acquire(const queue_t *q, const void **slot);
+
+    /**
+     * @ingroup queue
+     * @brief Release (remove) the element obtained with queue_acquire().
+     *
+     * @param[in,out] q Pointer to queue instance.
+     *
+     * @retval QUEUE_OK    Oldest element removed.
+     * @retval QUEUE_EMPTY Queue empty — nothing to release.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_release(queue_t *q);
+
+    /**
+     * @ingroup queue
+     * @brief Get the largest contiguous readable region starting at `head`.
+     *
+     * @param[in]  q    Pointer to queue instance.
+     * @param[out] span Receives a pointer to the element at `head` inside `buffer`.
+     * @param[out] n    Receives the number of contiguous elements (0 if empty).
+     *
+     * @retval QUEUE_OK    `*n` (> 0) elements readable at `*span`.
+     * @retval QUEUE_EMPTY Queue empty (`*n` = 0, `*span` unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @details
+     *  The region ends at the stored data or at the end of the buffer,
+     *  whichever comes first. Consume it with queue_read_advance() once the
+     *  transfer (e.g. a DMA TX) has completed; a second call then returns
+     *  the part after the wrap point.
+     */
+    queue_status_t queue_read_span(const queue_t *q, const void **span, queue_index_t *n);
+
+    /**
+     * @ingroup queue
+     * @brief Get the largest contiguous writable region starting at `tail`.
+     *
+     * @param[in]  q    Pointer to queue instance.
+     * @param[out] span Receives a pointer to the free slot at `tail` inside `buffer`.
+     * @param[out] n    Receives the number of contiguous free slots (0 if full).
+     *
+     * @retval QUEUE_OK    `*n` (> 0) slots writable at `*span`.
+     * @retval QUEUE_FULL  Queue full (`*n` = 0, `*span` unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @details
+     *  Fill the region (e.g. with a DMA RX) and publish the written elements
+     *  with queue_write_advance().
+     */
+    queue_status_t queue_write_span(const queue_t *q, void **span, queue_index_t *n);
+
+    /**
+     * @ingroup queue
+     * @brief Remove `n` elements from `head` without copying them.
+     *
+     * @param[in,out] q Pointer to queue instance.
+     * @param[in]     n Number of elements to consume (<= stored count).
+     *
+     * @retval QUEUE_OK    `n` elements removed.
+     * @retval QUEUE_ERROR Invalid parameters or `n` larger than the stored count.
+     */
+    queue_status_t queue_read_advance(queue_t *q, queue_index_t n);
+
+    /**
+     * @ingroup queue
+     * @brief Publish `n` elements written in place at `tail`.
+     *
+     * @param[in,out] q Pointer to queue instance.
+     * @param[in]     n Number of elements to commit (<= free space).
+     *
+     * @retval QUEUE_OK    `n` elements added.
+     * @retval QUEUE_ERROR Invalid parameters or `n` larger than the free space.
+     */
+    queue_status_t queue_write_advance(queue_t *q, queue_index_t n);
+
+#if QUEUE_CFG_INLINE_QUERIES
+    /* Header-only state queries (QUEUE_CFG_INLINE_QUERIES = 1): the compiler
+     * can inline them into polling loops and hoist the loads. */
+
+    /**
+     * @ingroup queue
+     * @brief Check if queue is empty.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue empty or q is NULL.
+     * @return false — otherwise.
+     */
+    static inline bool queue_is_empty(const queue_t *q)
+    {
+        return (q == NULL) || (q->count == 0U);
+    }
+
+    /**
+     * @ingroup queue
+     * @brief Check if queue is full.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue full.
+     * @return false — otherwise (including q is NULL).
+     */
+    static inline bool queue_is_full(const queue_t *q)
+    {
+        return (q != NULL) && (q->count == q->capacity);
+    }
+
+    /**
+     * @ingroup queue
+     * @brief Number of stored elements.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return Element count, 0 if q is NULL.
+     */
+    static inline queue_index_t queue_count(const queue_t *q)
+    {
+        return (q != NULL) ? q->count : 0U;
+    }
+
+    /**
+     * @ingroup queue
+     * @brief Number of elements that can still be pushed.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return capacity − count, 0 if q is NULL.
+     */
+    static inline queue_index_t queue_free_space(const queue_t *q)
+    {
+        return (q != NULL) ? (queue_index_t)((uint32_t)q->capacity - (uint32_t)q->count) : 0U;
+    }
+#else
     /**
      * @ingroup queue
      * @brief Check if queue is empty.
@@ -169,6 +705,50 @@ extern "C"
      */
     bool queue_is_full(const queue_t *q);
 
+    /**
+     * @ingroup queue
+     * @brief Number of stored elements.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return Element count, 0 if q is NULL.
+     */
+    queue_index_t queue_count(const queue_t *q);
+
+    /**
+     * @ingroup queue
+     * @brief Number of elements that can still be pushed.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return capacity − count, 0 if q is NULL.
+     */
+    queue_index_t queue_free_space(const queue_t *q);
+#endif /* QUEUE_CFG_INLINE_QUERIES */
+
+#if QUEUE_CFG_STATS
+    /**
+     * @ingroup queue
+     * @brief Read the statistics of a queue (QUEUE_CFG_STATS = 1).
+     *
+     * @param[in]  q     Pointer to queue instance.
+     * @param[out] stats Destination for a copy of the counters.
+     *
+     * @retval QUEUE_OK    Statistics copied.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_get_stats(const queue_t *q, queue_stats_t *stats);
+
+    /**
+     * @ingroup queue
+     * @brief Reset the statistics of a queue (QUEUE_CFG_STATS = 1).
+     *
+     * @param[in,out] q Pointer to queue instance.
+     *
+     * @retval QUEUE_OK    Counters cleared, high-water mark set to the current count.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_reset_stats(queue_t *q);
+#endif
+
     /**
      * @page MISRA_Compliance MISRA Compliance
      * @section misra_overview Overview
@@ -183,6 +763,7 @@ extern "C"
      * | ID | Rule | Description | Justification |
      * |----|------|--------------|----------------|
      * | **DV-QUEUE-001** | MISRA-C:2012 Rule 11.4 | Cast between `void*` and `uint8_t*` for raw byte copying. | Controlled and justified cast, no aliasing or type reinterpretation. Enables a generic queue implementation. Tested indirectly via DV_QUEUE_001 unit tests, including NULL and edge cases. |
+     * | **DV-QUEUE-002** | MISRA-C:2012 Rules 11.3, 11.4 | Cast from `uint8_t*` to half-word/word pointers and from pointers to `uintptr_t` in the copy engine. | Word access only after an explicit alignment check; word types are declared `may_alias`. Tested via queue_copy unit tests for all sizes and alignments. |
      *
      * @see docs/compliance/MISRA_Deviations.md
      *
@@ -0,0 +1,178 @@
+/**
+ * @file queue_config.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Compile-time configuration of the queue library.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  All options can be overridden from the build system (e.g. `-DQUEUE_CFG_...=0`).
+ *  The defaults keep the original small-footprint, single-context behavior.
+ *
+ * @ingroup queue
+ */
+
+#ifndef QUEUE_CONFIG_H
+#define QUEUE_CONFIG_H
+
+/**
+ * @brief Use C11 `<stdatomic.h>` for the concurrent queue variants.
+ *
+ * Detected automatically from `__STDC_VERSION__`. When set to 0 the SPSC
+ * variant falls back to `volatile` indices ordered by @ref QUEUE_SPSC_BARRIER.
+ */
+#ifndef QUEUE_CFG_USE_C11_ATOMICS
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__) && !defined(__cplusplus)
+#define QUEUE_CFG_USE_C11_ATOMICS 1
+#else
+#define QUEUE_CFG_USE_C11_ATOMICS 0
+#endif
+#endif
+
+/**
+ * @brief Memory barrier hook for the SPSC variant without C11 atomics.
+ *
+ * Must order all preceding memory accesses before all following ones
+ * (e.g. `__DMB()` on Cortex-M, or a compiler barrier on single-core parts).
+ */
+#if (QUEUE_CFG_USE_C11_ATOMICS == 0) && !defined(QUEUE_SPSC_BARRIER)
+#if defined(__GNUC__) || defined(__clang__)
+#define QUEUE_SPSC_BARRIER() __sync_synchronize()
+#else
+#error "QUEUE_SPSC_BARRIER() must be defined when C11 atomics are not available"
+#endif
+#endif
+
+/**
+ * @brief Width of `queue_t` indices, counts, capacity and element size.
+ *
+ * 16 (default) — `queue_index_t` is uint16_t: up to 65535 elements of up to
+ *                65535 bytes, smallest control structure.
+ * 32           — `queue_index_t` is uint32_t for large host-side rings; the
+ *                whole buffer (element size × capacity) must stay below 4 GiB.
+ *
+ * @note Must have the same value for the library and all its users.
+ */
+#ifndef QUEUE_CFG_INDEX_BITS
+#define QUEUE_CFG_INDEX_BITS 16
+#endif
+
+/**
+ * @brief Compile queue statistics / high-water-mark instrumentation into `queue_t`.
+ *
+ * 0 (default) — no statistics fields, no counting code, no stats API.
+ * 1           — `queue_t::stats` is maintained by every operation and the
+ *               queue_get_stats() / queue_reset_stats() API is available.
+ *
+ * @note Must have the same value for the library and all its users.
+ */
+#ifndef QUEUE_CFG_STATS
+#define QUEUE_CFG_STATS 0
+#endif
+
+/**
+ * @brief Count pushed elements in `queue_t` for incremental snapshots.
+ *
+ * 0 (default) — no extra fields; only full snapshot records (queue_snapshot.h).
+ * 1           — `queue_t::push_seq` counts every element added by any push or
+ *               commit variant, `queue_t::rewrites` counts changes that are
+ *               not FIFO pushes or pops (queue_remove_if(), coalescing
+ *               replace), and queue_snapshot_delta() is available.
+ *
+ * @note Must have the same value for the library and all its users.
+ */
+#ifndef QUEUE_CFG_SNAPSHOT
+#define QUEUE_CFG_SNAPSHOT 0
+#endif
+
+/**
+ * @brief Per-queue element copy hooks in `queue_t`.
+ *
+ * 0 (default) — elements are always moved by the built-in copy engine.
+ * 1           — `queue_t::copy` holds optional copy-in / copy-out functions
+ *               set with queue_init_ex() (e.g. DMA engine, cache-maintenance
+ *               or non-temporal copies); NULL hooks use the copy engine.
+ *
+ * @note Must have the same value for the library and all its users.
+ */
+#ifndef QUEUE_CFG_COPY_HOOK
+#define QUEUE_CFG_COPY_HOOK 0
+#endif
+
+/** @brief Validation level: every argument checked, QUEUE_ERROR on failure. */
+#define QUEUE_VALIDATION_FULL 2
+/** @brief Validation level: argument checks become QUEUE_ASSERT() only. */
+#define QUEUE_VALIDATION_ASSERT 1
+/** @brief Validation level: no argument checks on the operation paths. */
+#define QUEUE_VALIDATION_NONE 0
+
+/**
+ * @brief Argument checking performed by the `queue_t` operations.
+ *
+ * QUEUE_VALIDATION_FULL (default) — NULL pointers are rejected with QUEUE_ERROR.
+ * QUEUE_VALIDATION_ASSERT         — NULL pointers trigger QUEUE_ASSERT() (defaults
+ *                                   to assert(), overridable); no error path.
+ * QUEUE_VALIDATION_NONE           — no argument checks; for trusted callers
+ *                                   operating on already validated queues.
+ *
+ * queue_init() / queue_init_pow2() validate their arguments at every level.
+ * Full/empty detection and QUEUE_FULL / QUEUE_EMPTY codes are not affected.
+ */
+#ifndef QUEUE_CFG_VALIDATION
+#define QUEUE_CFG_VALIDATION QUEUE_VALIDATION_FULL
+#endif
+
+/**
+ * @brief Provide the `queue_t` state queries as header-only inline functions.
+ *
+ * 1 (default) — queue_is_empty(), queue_is_full(), queue_count() and
+ *               queue_free_space() are `static inline` in queue.h.
+ * 0           — the same functions are out-of-line in queue.c (one
+ *               linkable symbol each, e.g. for callers written in other languages).
+ */
+#ifndef QUEUE_CFG_INLINE_QUERIES
+#define QUEUE_CFG_INLINE_QUERIES 1
+#endif
+
+/**
+ * @brief Place producer-owned and consumer-owned fields of the concurrent
+ *        queue variants (SPSC, MPMC) on separate cache lines.
+ *
+ * 0 (default) — compact layout, for single-core parts without a data cache.
+ * 1           — `head` and `tail` groups are aligned to
+ *               @ref QUEUE_CFG_CACHE_LINE_SIZE, so the producer and the
+ *               consumer never write to the same cache line (no false sharing).
+ *
+ * @note Must have the same value for the library and all its users.
+ */
+#ifndef QUEUE_CFG_CACHE_LINE_ALIGN
+#define QUEUE_CFG_CACHE_LINE_ALIGN 0
+#endif
+
+/**
+ * @brief Cache line size in bytes used when @ref QUEUE_CFG_CACHE_LINE_ALIGN is 1.
+ */
+#ifndef QUEUE_CFG_CACHE_LINE_SIZE
+#define QUEUE_CFG_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * @brief Alignment specifier starting a new cache line for a structure member.
+ */
+#if QUEUE_CFG_CACHE_LINE_ALIGN
+#if defined(__cplusplus)
+#define QUEUE_CACHE_ALIGNED alignas(QUEUE_CFG_CACHE_LINE_SIZE)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define QUEUE_CACHE_ALIGNED _Alignas(QUEUE_CFG_CACHE_LINE_SIZE)
+#elif defined(__GNUC__) || defined(__clang__)
+#define QUEUE_CACHE_ALIGNED __attribute__((aligned(QUEUE_CFG_CACHE_LINE_SIZE)))
+#else
+#error "QUEUE_CFG_CACHE_LINE_ALIGN requires C11, C++11 or a GCC/Clang compatible compiler"
+#endif
+#else
+#define QUEUE_CACHE_ALIGNED
+#endif
+
+#endif /* QUEUE_CONFIG_H */
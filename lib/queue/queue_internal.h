@@ -0,0 +1,233 @@
+/**
+ * @file queue_internal.h
+ * @brief Library-internal helpers shared between the queue variants.
+ *
+ * @details
+ *  Not part of the public API — include only from `lib/queue` sources.
+ *
+ * @ingroup queue_internal
+ */
+
+#ifndef QUEUE_INTERNAL_H
+#define QUEUE_INTERNAL_H
+
+#include "queue.h"
+#include "queue_config.h"
+#include "queue_mpmc.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#if (QUEUE_CFG_VALIDATION == QUEUE_VALIDATION_ASSERT) && !defined(QUEUE_ASSERT)
+#include <assert.h>
+/** @brief Assertion used by QUEUE_VALIDATION_ASSERT; define to override. */
+#define QUEUE_ASSERT(expr) assert(expr)
+#endif
+
+/**
+ * @ingroup queue_internal
+ * @brief Evaluate an argument-error condition according to QUEUE_CFG_VALIDATION.
+ *
+ * @details Expands to `(cond)` at QUEUE_VALIDATION_FULL, to an assertion on
+ *          `!(cond)` followed by `false` at QUEUE_VALIDATION_ASSERT and to
+ *          `false` at QUEUE_VALIDATION_NONE, so the compiler drops the error
+ *          branch of `if (QUEUE_ARG_INVALID(...))` in the last two levels.
+ */
+#if (QUEUE_CFG_VALIDATION == QUEUE_VALIDATION_FULL)
+#define QUEUE_ARG_INVALID(cond) (cond)
+#elif (QUEUE_CFG_VALIDATION == QUEUE_VALIDATION_ASSERT)
+#define QUEUE_ARG_INVALID(cond) (QUEUE_ASSERT(!(cond)), false)
+#elif (QUEUE_CFG_VALIDATION == QUEUE_VALIDATION_NONE)
+#define QUEUE_ARG_INVALID(cond) (false)
+#else
+#error "QUEUE_CFG_VALIDATION must be QUEUE_VALIDATION_FULL, _ASSERT or _NONE"
+#endif
+
+/**
+ * @ingroup queue_internal
+ * @brief Copy engine entry point shared by all queue variants.
+ *
+ * @param[out] dst  Destination buffer.
+ * @param[in]  src  Source buffer.
+ * @param[in]  size Number of bytes to copy.
+ *
+ * @note Same size/alignment dispatch as the `copy_bytes()` helper in queue.c.
+ */
+void queue_copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t size);
+
+/**
+ * @ingroup queue_internal
+ * @brief Store bytes into a `queue_t` slot the way a push does.
+ *
+ * @param[in]  q    Queue instance (copy-in hook).
+ * @param[out] slot Destination in the queue storage.
+ * @param[in]  src  Source bytes.
+ * @param[in]  size Number of bytes (0 — nothing to do).
+ *
+ * @note Goes through `q->copy.copy_in` when QUEUE_CFG_COPY_HOOK is enabled,
+ *       otherwise straight to the copy engine.
+ */
+void queue_copy_in(const queue_t *q, uint8_t *slot, const uint8_t *src, uint32_t size);
+
+/**
+ * @ingroup queue_internal
+ * @brief Count leading zero bits of a non-zero word.
+ *
+ * @param[in] x Value (!= 0).
+ *
+ * @return Number of leading zeros (0..31).
+ *
+ * @details The compiler builtin (CLZ on Cortex-M3 and later, LZCNT/BSR on
+ *          x86) when available, otherwise a fixed five-step binary search.
+ */
+static inline uint8_t queue_clz32(uint32_t x)
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (__SIZEOF_INT__ == 4)
+    return (uint8_t)__builtin_clz(x);
+#else
+    uint32_t v = x;
+    uint8_t n = 0U;
+
+    if ((v & 0xFFFF0000U) == 0U)
+    {
+        n = (uint8_t)(n + 16U);
+        v <<= 16U;
+    }
+    if ((v & 0xFF000000U) == 0U)
+    {
+        n = (uint8_t)(n + 8U);
+        v <<= 8U;
+    }
+    if ((v & 0xF0000000U) == 0U)
+    {
+        n = (uint8_t)(n + 4U);
+        v <<= 4U;
+    }
+    if ((v & 0xC0000000U) == 0U)
+    {
+        n = (uint8_t)(n + 2U);
+        v <<= 2U;
+    }
+    if ((v & 0x80000000U) == 0U)
+    {
+        n = (uint8_t)(n + 1U);
+    }
+
+    return n;
+#endif
+}
+
+/**
+ * @ingroup queue_internal
+ * @brief Atomic access to `queue_mpmc_atomic_t` counters (MPMC and shared-memory variants).
+ *
+ * @details C11 `<stdatomic.h>` when available, otherwise the GCC/Clang
+ *          `__atomic` builtins. Left undefined on other compilers; the
+ *          modules that need them report that with `#error`.
+ */
+#if QUEUE_CFG_USE_C11_ATOMICS
+#define QUEUE_ATOMIC_LOAD_RELAXED(p)     atomic_load_explicit((p), memory_order_relaxed)
+#define QUEUE_ATOMIC_LOAD_ACQUIRE(p)     atomic_load_explicit((p), memory_order_acquire)
+#define QUEUE_ATOMIC_STORE_RELAXED(p, v) atomic_store_explicit((p), (v), memory_order_relaxed)
+#define QUEUE_ATOMIC_STORE_RELEASE(p, v) atomic_store_explicit((p), (v), memory_order_release)
+#define QUEUE_ATOMIC_CAS_RELAXED(p, expected, desired) \
+    atomic_compare_exchange_weak_explicit((p), (expected), (desired), memory_order_relaxed, memory_order_relaxed)
+#elif defined(__GNUC__) || defined(__clang__)
+#define QUEUE_ATOMIC_LOAD_RELAXED(p)     __atomic_load_n((p), __ATOMIC_RELAXED)
+#define QUEUE_ATOMIC_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define QUEUE_ATOMIC_STORE_RELAXED(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define QUEUE_ATOMIC_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define QUEUE_ATOMIC_CAS_RELAXED(p, expected, desired) \
+    __atomic_compare_exchange_n((p), (expected), (desired), true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#endif
+
+#if defined(QUEUE_ATOMIC_CAS_RELAXED)
+/**
+ * @ingroup queue_internal
+ * @brief One side of a slot-sequence ring, as seen by queue_mpmc_claim().
+ */
+typedef struct
+{
+    queue_mpmc_atomic_t *seq;   /**< Slot sequence array (capacity entries). */
+    queue_mpmc_atomic_t *index; /**< `tail` (producers) or `head` (consumers). */
+    uint32_t index_mask;        /**< capacity − 1 (capacity is a power of two). */
+    uint32_t expect_offset;     /**< 0 for producers (slots free), 1 for consumers (slots full). */
+} queue_mpmc_side_t;
+
+/**
+ * @ingroup queue_internal
+ * @brief First non-zero slot distance of a run of indices.
+ *
+ * @param[in] side  Ring side.
+ * @param[in] first First index of the run.
+ * @param[in] n     Run length (>= 1, <= capacity).
+ *
+ * @return 0 — every slot ready, < 0 — a slot is still owned by the other
+ *         side, > 0 — `first` is stale (another context already claimed it).
+ *
+ * @note Index and sequence values wrap at 2^32; the distance relies on two's
+ *       complement conversion of the wrapped difference.
+ */
+static inline int32_t queue_mpmc_run_distance(const queue_mpmc_side_t *side, uint32_t first, uint32_t n)
+{
+    int32_t distance = 0;
+
+    for (uint32_t k = 0U; (k < n) && (distance == 0); k++)
+    {
+        const uint32_t seq = QUEUE_ATOMIC_LOAD_ACQUIRE(&side->seq[(first + k) & side->index_mask]);
+
+        distance = (int32_t)(seq - (first + k + side->expect_offset));
+    }
+
+    return distance;
+}
+
+/**
+ * @ingroup queue_internal
+ * @brief Claim the next `n` consecutive indices of one side of a ring.
+ *
+ * @param[in]  side    Ring side.
+ * @param[in]  n       Number of indices to claim (>= 1, <= capacity).
+ * @param[out] claimed First claimed index on success.
+ *
+ * @return true — run claimed, false — fewer than `n` slots free (producers)
+ *         / filled (consumers).
+ *
+ * @details
+ *  Producers expect a slot sequence equal to the index, consumers the index
+ *  plus one. Every slot of the run is checked because the other side
+ *  releases slots in any order. Retries only when another context of the
+ *  same side won the compare-and-swap, i.e. when the system as a whole made
+ *  progress.
+ */
+static inline bool queue_mpmc_claim(const queue_mpmc_side_t *side, uint32_t n, uint32_t *claimed)
+{
+    uint32_t current = QUEUE_ATOMIC_LOAD_RELAXED(side->index);
+    bool done = false;
+    bool success = false;
+
+    while (!done)
+    {
+        const int32_t distance = queue_mpmc_run_distance(side, current, n);
+
+        if (distance == 0)
+        {
+            /* on failure `current` is reloaded with the winner's value */
+            success = QUEUE_ATOMIC_CAS_RELAXED(side->index, &current, current + n);
+            done = success;
+        }
+        else if (distance < 0)
+        {
+            done = true;
+        }
+        else
+        {
+            current = QUEUE_ATOMIC_LOAD_RELAXED(side->index);
+        }
+    }
+    *claimed = current;
+
+    return success;
+}
+#endif
+
+#endif /* QUEUE_INTERNAL_H */
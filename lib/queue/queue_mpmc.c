@@ -0,0 +1,230 @@
+/**
+ * @file queue_mpmc.c
+ * @brief Lock-free multi-producer / multi-consumer FIFO queue implementation.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  A producer reads `tail`, checks that the slot's sequence equals it, and
+ *  claims the slot with a compare-and-swap on `tail`. After copying the
+ *  element it publishes the slot with a release store of `tail + 1` into the
+ *  sequence. Consumers mirror this on `head` and hand the slot back to the
+ *  producers by storing `head + capacity`. Index and sequence values wrap at
+ *  2^32; their distance is evaluated as a signed 32-bit difference.
+ *
+ *  The multi-element calls claim a run of `n` consecutive indices with one
+ *  compare-and-swap, after checking the sequence of every slot in the run,
+ *  and then publish the slots one by one.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
+ *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_mpmc.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+#if !defined(QUEUE_ATOMIC_CAS_RELAXED)
+#error "queue_mpmc requires C11 atomics or the GCC/Clang __atomic builtins"
+#endif
+
+static bool mpmc_claim(const queue_mpmc_t *q, queue_mpmc_atomic_t *index, uint32_t n, uint32_t *claimed);
+
+/* -------------------------- */
+/* MPMC API implementation    */
+/* -------------------------- */
+
+queue_status_t queue_mpmc_init(queue_mpmc_t *q, const queue_mpmc_storage_t *storage, uint16_t buffer_element_size,
+                               uint16_t queue_capacity)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (storage == NULL) || (buffer_element_size == 0U) || (queue_capacity < 2U) ||
+        ((queue_capacity & (uint16_t)(queue_capacity - 1U)) != 0U))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if ((storage->buffer == NULL) || (storage->seq == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        queue_mpmc_atomic_t *seq = storage->seq;
+
+        q->buffer = storage->buffer;
+        q->seq = seq;
+        q->buffer_element_size = buffer_element_size;
+        q->capacity = queue_capacity;
+        q->index_mask = (uint32_t)queue_capacity - 1U;
+        for (uint32_t i = 0U; i < (uint32_t)queue_capacity; i++)
+        {
+            QUEUE_ATOMIC_STORE_RELAXED(&seq[i], i);
+        }
+        QUEUE_ATOMIC_STORE_RELAXED(&q->head, 0U);
+        QUEUE_ATOMIC_STORE_RELEASE(&q->tail, 0U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_mpmc_push(queue_mpmc_t *q, const void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    uint32_t index = 0U;
+
+    if ((q == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (!mpmc_claim(q, &q->tail, 1U, &index))
+    {
+        ret_status = QUEUE_FULL;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        uint8_t *base = (uint8_t *)q->buffer;
+        const uint32_t slot = index & q->index_mask;
+
+        queue_copy_bytes(&base[slot * (uint32_t)q->buffer_element_size], (const uint8_t *)item,
+                         q->buffer_element_size);
+        QUEUE_ATOMIC_STORE_RELEASE(&q->seq[slot], index + 1U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_mpmc_pop(queue_mpmc_t *q, void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    uint32_t index = 0U;
+
+    if ((q == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (!mpmc_claim(q, &q->head, 1U, &index))
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        const uint8_t *base = (const uint8_t *)q->buffer;
+        const uint32_t slot = index & q->index_mask;
+
+        queue_copy_bytes((uint8_t *)item, &base[slot * (uint32_t)q->buffer_element_size], q->buffer_element_size);
+        QUEUE_ATOMIC_STORE_RELEASE(&q->seq[slot], index + q->index_mask + 1U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_mpmc_push_all(queue_mpmc_t *q, const void *items, uint16_t n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    uint32_t index = 0U;
+
+    if ((q == NULL) || (items == NULL) || (n > q->capacity))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if ((n != 0U) && !mpmc_claim(q, &q->tail, n, &index))
+    {
+        ret_status = QUEUE_FULL;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        uint8_t *base = (uint8_t *)q->buffer;
+        const uint8_t *src = (const uint8_t *)items;
+        const uint32_t element_size = (uint32_t)q->buffer_element_size;
+
+        for (uint32_t k = 0U; k < (uint32_t)n; k++)
+        {
+            const uint32_t slot = (index + k) & q->index_mask;
+
+            queue_copy_bytes(&base[slot * element_size], &src[k * element_size], q->buffer_element_size);
+            QUEUE_ATOMIC_STORE_RELEASE(&q->seq[slot], index + k + 1U);
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_mpmc_pop_exact(queue_mpmc_t *q, void *items, uint16_t n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    uint32_t index = 0U;
+
+    if ((q == NULL) || (items == NULL) || (n > q->capacity))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if ((n != 0U) && !mpmc_claim(q, &q->head, n, &index))
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        const uint8_t *base = (const uint8_t *)q->buffer;
+        uint8_t *dst = (uint8_t *)items;
+        const uint32_t element_size = (uint32_t)q->buffer_element_size;
+
+        for (uint32_t k = 0U; k < (uint32_t)n; k++)
+        {
+            const uint32_t slot = (index + k) & q->index_mask;
+
+            queue_copy_bytes(&dst[k * element_size], &base[slot * element_size], q->buffer_element_size);
+            QUEUE_ATOMIC_STORE_RELEASE(&q->seq[slot], index + k + q->index_mask + 1U);
+        }
+    }
+
+    return ret_status;
+}
+
+bool queue_mpmc_is_empty(queue_mpmc_t *q)
+{
+    bool is_empty = true;
+
+    if (q != NULL)
+    {
+        is_empty = (QUEUE_ATOMIC_LOAD_ACQUIRE(&q->head) == QUEUE_ATOMIC_LOAD_ACQUIRE(&q->tail));
+    }
+
+    return is_empty;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Claim the next `n` consecutive indices of one side of the queue.
+ *
+ * @param[in]     q       Queue instance (sequence array and mask).
+ * @param[in,out] index   `tail` (producers) or `head` (consumers).
+ * @param[in]     n       Number of indices to claim (>= 1, <= capacity).
+ * @param[out]    claimed First claimed index on success.
+ *
+ * @return true — run claimed, false — fewer than `n` slots free (producers)
+ *         / filled (consumers).
+ *
+ * @note Protocol in queue_mpmc_claim() (queue_internal.h), shared with queue_shm.c.
+ */
+static bool mpmc_claim(const queue_mpmc_t *q, queue_mpmc_atomic_t *index, uint32_t n, uint32_t *claimed)
+{
+    const queue_mpmc_side_t side = {q->seq, index, q->index_mask, (index == &q->head) ? 1U : 0U};
+
+    return queue_mpmc_claim(&side, n, claimed);
+}
+
+/** @} */ /* end of queue_internal group */
\ No newline at end of file
@@ -0,0 +1,187 @@
+/**
+ * @file queue_mpmc.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Lock-free multi-producer / multi-consumer bounded FIFO queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Variant of the generic FIFO queue for SMP systems where several contexts
+ *  push and several contexts pop concurrently, without an external mutex.
+ *
+ *  The implementation:
+ *  - follows D. Vyukov's bounded MPMC design: every slot carries a sequence
+ *    number telling producers and consumers whether the slot is ready for
+ *    them, so producers only contend on `tail` and consumers only on `head`
+ *    (one compare-and-swap per successful operation),
+ *  - offers try-only operations returning QUEUE_FULL / QUEUE_EMPTY instead of
+ *    blocking,
+ *  - requires a power-of-two capacity so the slot is `index & mask`,
+ *  - uses C11 atomics, or the GCC/Clang `__atomic` builtins when
+ *    @ref QUEUE_CFG_USE_C11_ATOMICS is 0,
+ *  - avoids dynamic memory allocation: element storage and the sequence
+ *    array are both supplied by the caller.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4) applies to the element copy.
+ *
+ * @note
+ *  Operations are lock-free, not wait-free: a compare-and-swap that loses a
+ *  race is retried, so an individual call may spin while other contexts make
+ *  progress. queue_mpmc_init() must complete before any other call.
+ */
+
+#ifndef QUEUE_MPMC_H
+#define QUEUE_MPMC_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include "queue_config.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#if QUEUE_CFG_USE_C11_ATOMICS
+#include <stdatomic.h>
+    /** @brief Index / sequence counter shared between all contexts. */
+    typedef _Atomic uint32_t queue_mpmc_atomic_t;
+#else
+    /** @brief Index / sequence counter shared between all contexts (accessed via `__atomic` builtins). */
+    typedef uint32_t queue_mpmc_atomic_t;
+#endif
+
+    /**
+     * @ingroup queue
+     * @brief Caller-supplied storage of an MPMC queue.
+     */
+    typedef struct
+    {
+        void *buffer;             /**< Element storage (buffer_element_size × capacity bytes). */
+        queue_mpmc_atomic_t *seq; /**< Sequence counters (capacity entries). */
+    } queue_mpmc_storage_t;
+
+    /**
+     * @ingroup queue
+     * @brief MPMC queue control structure.
+     *
+     * @details
+     *  `tail` is claimed by producers, `head` by consumers; both increase
+     *  monotonically and wrap at 2^32. `seq[i]` equals the index a producer
+     *  expects when slot `i` is free, and that index + 1 once the slot holds data.
+     *  With @ref QUEUE_CFG_CACHE_LINE_ALIGN, `head` and `tail` start on separate
+     *  cache lines, away from the read-only fields.
+     */
+    typedef struct
+    {
+        void *buffer;                                 /**< Pointer to user-provided data buffer. */
+        queue_mpmc_atomic_t *seq;                     /**< Pointer to user-provided sequence array (capacity entries). */
+        uint16_t buffer_element_size;                 /**< Element size in bytes (> 0). */
+        uint16_t capacity;                            /**< Maximum number of elements (power of two, >= 2). */
+        uint32_t index_mask;                          /**< capacity − 1. */
+        QUEUE_CACHE_ALIGNED queue_mpmc_atomic_t head; /**< Next index to pop (consumers). */
+        QUEUE_CACHE_ALIGNED queue_mpmc_atomic_t tail; /**< Next index to push (producers). */
+    } queue_mpmc_t;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize an MPMC queue instance.
+     *
+     * @param[in,out] q            Pointer to queue control structure.
+     * @param[in]     storage      Element buffer and sequence array (both non-NULL).
+     * @param[in]     buffer_element_size Element size in bytes (must > 0).
+     * @param[in]     queue_capacity Number of elements (power of two, >= 2).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments (NULL, 0, capacity not a power of two or < 2).
+     *
+     * @note Not thread-safe; call before any producer or consumer starts. O(capacity).
+     */
+    queue_status_t queue_mpmc_init(queue_mpmc_t *q, const queue_mpmc_storage_t *storage, uint16_t buffer_element_size,
+                                   uint16_t queue_capacity);
+
+    /**
+     * @ingroup queue
+     * @brief Try to push one element (any producer).
+     *
+     * @param[in,out] q    Pointer to queue instance.
+     * @param[in]     item Pointer to element data to add.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_FULL  Queue full (never blocks).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Lock-free.
+     */
+    queue_status_t queue_mpmc_push(queue_mpmc_t *q, const void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Try to pop one element (any consumer).
+     *
+     * @param[in,out] q    Pointer to queue instance.
+     * @param[out]    item Pointer to destination buffer to store element.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_EMPTY Queue empty — no element available (item unchanged, never blocks).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Lock-free.
+     */
+    queue_status_t queue_mpmc_pop(queue_mpmc_t *q, void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Push exactly `n` elements or none (any producer).
+     *
+     * @param[in,out] q     Pointer to queue instance.
+     * @param[in]     items Pointer to an array of `n` elements.
+     * @param[in]     n     Number of elements (<= capacity).
+     *
+     * @retval QUEUE_OK    All `n` elements added as one contiguous run.
+     * @retval QUEUE_FULL  Fewer than `n` free slots — nothing added.
+     * @retval QUEUE_ERROR Invalid parameters or `n` > capacity.
+     *
+     * @note The run is claimed with one compare-and-swap, so no other
+     *       producer's element lands inside it; its slots are then published
+     *       one by one.
+     */
+    queue_status_t queue_mpmc_push_all(queue_mpmc_t *q, const void *items, uint16_t n);
+
+    /**
+     * @ingroup queue
+     * @brief Pop exactly `n` elements or none (any consumer).
+     *
+     * @param[in,out] q     Pointer to queue instance.
+     * @param[out]    items Destination array of `n` elements.
+     * @param[in]     n     Number of elements (<= capacity).
+     *
+     * @retval QUEUE_OK    The `n` oldest elements removed.
+     * @retval QUEUE_EMPTY Fewer than `n` published elements — nothing removed.
+     * @retval QUEUE_ERROR Invalid parameters or `n` > capacity.
+     *
+     * @note Elements whose producer has claimed but not yet published them
+     *       do not count; the call returns QUEUE_EMPTY instead of waiting.
+     */
+    queue_status_t queue_mpmc_pop_exact(queue_mpmc_t *q, void *items, uint16_t n);
+
+    /**
+     * @ingroup queue
+     * @brief Check if MPMC queue is empty.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue empty or q is NULL.
+     * @return false — otherwise.
+     *
+     * @note The result is a snapshot; it may change as soon as another context runs.
+     */
+    bool queue_mpmc_is_empty(queue_mpmc_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_MPMC_H */
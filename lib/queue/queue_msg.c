@@ -0,0 +1,235 @@
+/**
+ * @file queue_msg.c
+ * @brief Variable-length record queue implementation.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  The buffer is used as a byte ring. A record is its little-endian length
+ *  prefix followed by the payload; both parts wrap independently at the end
+ *  of the buffer, so no padding is ever inserted.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
+ *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_msg.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+static uint16_t msg_ring_write(queue_msg_t *q, uint16_t offset, const uint8_t *src, uint16_t n);
+static uint16_t msg_ring_read(const queue_msg_t *q, uint16_t offset, uint8_t *dst, uint16_t n);
+static uint16_t msg_read_len(const queue_msg_t *q);
+
+/* -------------------------- */
+/* Record queue API           */
+/* -------------------------- */
+
+queue_status_t queue_msg_init(queue_msg_t *q, void *buffer, uint16_t buffer_size)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (buffer == NULL) || (buffer_size <= QUEUE_MSG_HEADER_SIZE))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        q->buffer = buffer;
+        q->size = buffer_size;
+        q->head = 0U;
+        q->tail = 0U;
+        q->used = 0U;
+        q->count = 0U;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_msg_push(queue_msg_t *q, const void *data, uint16_t len)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (data == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (((uint32_t)len + QUEUE_MSG_HEADER_SIZE) > ((uint32_t)q->size - (uint32_t)q->used))
+    {
+        ret_status = QUEUE_FULL;
+    }
+    else
+    {
+        const uint8_t header[QUEUE_MSG_HEADER_SIZE] = {(uint8_t)(len & 0xFFU), (uint8_t)(len >> 8U)};
+        uint16_t offset = msg_ring_write(q, q->tail, header, QUEUE_MSG_HEADER_SIZE);
+
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        q->tail = msg_ring_write(q, offset, (const uint8_t *)data, len);
+        q->used = (uint16_t)((uint32_t)q->used + (uint32_t)len + QUEUE_MSG_HEADER_SIZE);
+        q->count++;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_msg_peek_len(const queue_msg_t *q, uint16_t *len)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (len == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        *len = msg_read_len(q);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_msg_pop(queue_msg_t *q, void *data, uint16_t data_size, uint16_t *len)
+{
+    queue_status_t ret_status = queue_msg_peek_len(q, len);
+
+    if ((ret_status == QUEUE_OK) && (data == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if ((ret_status == QUEUE_OK) && (*len > data_size))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (ret_status == QUEUE_OK)
+    {
+        uint16_t offset = msg_ring_read(q, q->head, NULL, QUEUE_MSG_HEADER_SIZE);
+
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        q->head = msg_ring_read(q, offset, (uint8_t *)data, *len);
+        q->used = (uint16_t)((uint32_t)q->used - (uint32_t)*len - QUEUE_MSG_HEADER_SIZE);
+        q->count--;
+    }
+    else
+    {
+        /* status from queue_msg_peek_len() is returned unchanged */
+    }
+
+    return ret_status;
+}
+
+bool queue_msg_is_empty(const queue_msg_t *q)
+{
+    return (q == NULL) || (q->count == 0U);
+}
+
+uint16_t queue_msg_free_space(const queue_msg_t *q)
+{
+    uint16_t free_space = 0U;
+
+    if (q != NULL)
+    {
+        const uint32_t free_bytes = (uint32_t)q->size - (uint32_t)q->used;
+
+        if (free_bytes > QUEUE_MSG_HEADER_SIZE)
+        {
+            free_space = (uint16_t)(free_bytes - QUEUE_MSG_HEADER_SIZE);
+        }
+    }
+
+    return free_space;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Copy `n` bytes into the ring starting at `offset`.
+ *
+ * @param[in,out] q      Queue instance (free space already checked).
+ * @param[in]     offset Start offset (< size).
+ * @param[in]     src    Source bytes.
+ * @param[in]     n      Number of bytes (<= size).
+ *
+ * @return Offset following the last written byte (< size).
+ *
+ * @details At most two contiguous block copies; no division.
+ */
+static uint16_t msg_ring_write(queue_msg_t *q, uint16_t offset, const uint8_t *src, uint16_t n)
+{
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+    uint8_t *base = (uint8_t *)q->buffer;
+    const uint32_t until_wrap = (uint32_t)q->size - (uint32_t)offset;
+    const uint32_t first = ((uint32_t)n < until_wrap) ? (uint32_t)n : until_wrap;
+    uint32_t next = (uint32_t)offset + (uint32_t)n;
+
+    queue_copy_bytes(&base[offset], src, first);
+    queue_copy_bytes(base, &src[first], (uint32_t)n - first);
+
+    if (next >= (uint32_t)q->size)
+    {
+        next -= (uint32_t)q->size;
+    }
+
+    return (uint16_t)next;
+}
+
+/**
+ * @brief Copy `n` bytes out of the ring starting at `offset`.
+ *
+ * @param[in]  q      Queue instance (enough stored bytes already checked).
+ * @param[in]  offset Start offset (< size).
+ * @param[out] dst    Destination bytes, or NULL to only skip the bytes.
+ * @param[in]  n      Number of bytes (<= size).
+ *
+ * @return Offset following the last read byte (< size).
+ */
+static uint16_t msg_ring_read(const queue_msg_t *q, uint16_t offset, uint8_t *dst, uint16_t n)
+{
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+    const uint8_t *base = (const uint8_t *)q->buffer;
+    const uint32_t until_wrap = (uint32_t)q->size - (uint32_t)offset;
+    const uint32_t first = ((uint32_t)n < until_wrap) ? (uint32_t)n : until_wrap;
+    uint32_t next = (uint32_t)offset + (uint32_t)n;
+
+    if (dst != NULL)
+    {
+        queue_copy_bytes(dst, &base[offset], first);
+        queue_copy_bytes(&dst[first], base, (uint32_t)n - first);
+    }
+
+    if (next >= (uint32_t)q->size)
+    {
+        next -= (uint32_t)q->size;
+    }
+
+    return (uint16_t)next;
+}
+
+/**
+ * @brief Decode the length prefix of the oldest record.
+ *
+ * @param[in] q Queue instance (at least one record stored).
+ *
+ * @return Payload length in bytes.
+ */
+static uint16_t msg_read_len(const queue_msg_t *q)
+{
+    uint8_t header[QUEUE_MSG_HEADER_SIZE] = {0U, 0U};
+
+    (void)msg_ring_read(q, q->head, header, QUEUE_MSG_HEADER_SIZE);
+
+    return (uint16_t)((uint32_t)header[0] | ((uint32_t)header[1] << 8U));
+}
+
+/** @} */ /* end of queue_internal group */
@@ -0,0 +1,151 @@
+/**
+ * @file queue_msg.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Deterministic FIFO of variable-length records (framed byte stream).
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Variant of the generic FIFO queue for data whose size differs from record
+ *  to record (log lines, protocol frames). Instead of padding every entry to
+ *  the largest element, records are stored back to back in a caller-supplied
+ *  byte buffer, each one preceded by a @ref QUEUE_MSG_HEADER_SIZE byte length
+ *  prefix.
+ *
+ *  The implementation:
+ *  - splits records at the end of the buffer instead of padding, so every
+ *    byte of the buffer is usable,
+ *  - stores the length prefix byte-wise (little-endian), so the buffer needs
+ *    no particular alignment,
+ *  - executes in O(record length) with at most two block copies per part,
+ *  - avoids dynamic memory allocation and standard library dependencies.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4) applies to the record copy.
+ *
+ * @note
+ *  Records are copied in and out; there is no zero-copy access because a
+ *  record may be split across the end of the buffer.
+ */
+
+#ifndef QUEUE_MSG_H
+#define QUEUE_MSG_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Size in bytes of the length prefix stored before every record. */
+#define QUEUE_MSG_HEADER_SIZE 2U
+
+    /**
+     * @ingroup queue
+     * @brief Variable-length record queue control structure.
+     *
+     * @details
+     *  `head` and `tail` are byte offsets into `buffer`; `used` counts stored
+     *  bytes including length prefixes, `count` the number of records.
+     */
+    typedef struct
+    {
+        void *buffer;     /**< Pointer to user-provided byte buffer. */
+        uint16_t size;    /**< Buffer size in bytes (> QUEUE_MSG_HEADER_SIZE). */
+        uint16_t head;    /**< Byte offset of the oldest record's prefix. */
+        uint16_t tail;    /**< Byte offset where the next record is written. */
+        uint16_t used;    /**< Stored bytes, prefixes included. */
+        uint16_t count;   /**< Number of stored records. */
+    } queue_msg_t;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a record queue instance.
+     *
+     * @param[in,out] q           Pointer to queue control structure.
+     * @param[in]     buffer      Pointer to caller-supplied byte buffer.
+     * @param[in]     buffer_size Buffer size in bytes (must > QUEUE_MSG_HEADER_SIZE).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments (NULL or buffer too small).
+     *
+     * @note Not thread-safe; caller must ensure exclusive access during init.
+     */
+    queue_status_t queue_msg_init(queue_msg_t *q, void *buffer, uint16_t buffer_size);
+
+    /**
+     * @ingroup queue
+     * @brief Append one record.
+     *
+     * @param[in,out] q    Pointer to queue instance.
+     * @param[in]     data Pointer to record payload.
+     * @param[in]     len  Payload length in bytes (0 allowed).
+     *
+     * @retval QUEUE_OK    Record stored.
+     * @retval QUEUE_FULL  Not enough free space for prefix + payload (queue unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic, O(len).
+     */
+    queue_status_t queue_msg_push(queue_msg_t *q, const void *data, uint16_t len);
+
+    /**
+     * @ingroup queue
+     * @brief Read the payload length of the oldest record without removing it.
+     *
+     * @param[in]  q   Pointer to queue instance.
+     * @param[out] len Payload length in bytes.
+     *
+     * @retval QUEUE_OK    Length written to `len`.
+     * @retval QUEUE_EMPTY Queue is empty (len unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_msg_peek_len(const queue_msg_t *q, uint16_t *len);
+
+    /**
+     * @ingroup queue
+     * @brief Remove the oldest record and copy its payload.
+     *
+     * @param[in,out] q         Pointer to queue instance.
+     * @param[out]    data      Destination buffer for the payload.
+     * @param[in]     data_size Size of `data` in bytes.
+     * @param[out]    len       Payload length of the oldest record.
+     *
+     * @retval QUEUE_OK    Record copied to `data` and removed.
+     * @retval QUEUE_EMPTY Queue is empty (data and len unchanged).
+     * @retval QUEUE_ERROR Invalid parameters, or `data_size` smaller than the
+     *                     record — the record stays queued and `len` reports
+     *                     the required size.
+     *
+     * @note Deterministic, O(len).
+     */
+    queue_status_t queue_msg_pop(queue_msg_t *q, void *data, uint16_t data_size, uint16_t *len);
+
+    /**
+     * @ingroup queue
+     * @brief Check if record queue is empty.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue empty or q is NULL.
+     * @return false — otherwise.
+     */
+    bool queue_msg_is_empty(const queue_msg_t *q);
+
+    /**
+     * @ingroup queue
+     * @brief Largest payload that can be pushed right now.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return Free bytes minus one length prefix (0 if no record fits or q is NULL).
+     */
+    uint16_t queue_msg_free_space(const queue_msg_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_MSG_H */
@@ -0,0 +1,262 @@
+/**
+ * @file queue_prio.c
+ * @brief Binary-heap priority queue implementation.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Push moves parents down into a hole rising from the first free slot until
+ *  the new key's position is found; pop moves the more urgent child up into
+ *  a hole sinking from the root until the last element fits. Each level
+ *  costs one key compare (two on the way down) and one element copy.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
+ *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_prio.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+static bool prio_before(const queue_prio_key_t *a, const queue_prio_key_t *b);
+static uint8_t *prio_slot(const queue_prio_t *q, uint16_t index);
+static void prio_move(queue_prio_t *q, uint16_t dst, uint16_t src);
+static uint16_t prio_sift_down(queue_prio_t *q, const queue_prio_key_t *key);
+
+/* -------------------------- */
+/* Priority queue API         */
+/* -------------------------- */
+
+queue_status_t queue_prio_init(queue_prio_t *q, const queue_prio_storage_t *storage, uint16_t buffer_element_size,
+                               uint16_t queue_capacity)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (storage == NULL) || (buffer_element_size == 0U) || (queue_capacity == 0U))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if ((storage->buffer == NULL) || (storage->keys == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        q->buffer = storage->buffer;
+        q->keys = storage->keys;
+        q->buffer_element_size = buffer_element_size;
+        q->capacity = queue_capacity;
+        q->count = 0U;
+#if QUEUE_CFG_PRIO_STABLE
+        q->next_seq = 0U;
+#endif
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_prio_push(queue_prio_t *q, const void *item, uint16_t priority)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count >= q->capacity)
+    {
+        ret_status = QUEUE_FULL;
+    }
+    else
+    {
+        queue_prio_key_t key;
+        uint16_t hole = q->count;
+        bool sifting = true;
+
+        key.priority = priority;
+#if QUEUE_CFG_PRIO_STABLE
+        key.seq = q->next_seq;
+        q->next_seq++;
+#endif
+        while (sifting && (hole > 0U))
+        {
+            const uint16_t parent = (uint16_t)(((uint32_t)hole - 1U) >> 1U);
+
+            if (prio_before(&key, &q->keys[parent]))
+            {
+                prio_move(q, hole, parent);
+                hole = parent;
+            }
+            else
+            {
+                sifting = false;
+            }
+        }
+
+        q->keys[hole] = key;
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        queue_copy_bytes(prio_slot(q, hole), (const uint8_t *)item, q->buffer_element_size);
+        q->count++;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_prio_pop(queue_prio_t *q, void *item, uint16_t *priority)
+{
+    queue_status_t ret_status = queue_prio_peek(q, item, priority);
+
+    if (ret_status == QUEUE_OK)
+    {
+        q->count--;
+        if (q->count > 0U)
+        {
+            const queue_prio_key_t last = q->keys[q->count];
+
+            prio_move(q, prio_sift_down(q, &last), q->count);
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_prio_peek(const queue_prio_t *q, void *item, uint16_t *priority)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        queue_copy_bytes((uint8_t *)item, prio_slot(q, 0U), q->buffer_element_size);
+        if (priority != NULL)
+        {
+            *priority = q->keys[0].priority;
+        }
+    }
+
+    return ret_status;
+}
+
+bool queue_prio_is_empty(const queue_prio_t *q)
+{
+    return (q == NULL) || (q->count == 0U);
+}
+
+bool queue_prio_is_full(const queue_prio_t *q)
+{
+    return (q != NULL) && (q->count == q->capacity);
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Heap order: is `a` served before `b`?
+ *
+ * @param[in] a First key.
+ * @param[in] b Second key.
+ *
+ * @return true if `a` has a smaller priority value, or an equal value and an
+ *         older sequence number (QUEUE_CFG_PRIO_STABLE).
+ *
+ * @note Sequence numbers are compared as a signed wrapped difference, valid
+ *       while the oldest stored element is less than 2^31 pushes old.
+ */
+static bool prio_before(const queue_prio_key_t *a, const queue_prio_key_t *b)
+{
+    bool before = (a->priority < b->priority);
+
+#if QUEUE_CFG_PRIO_STABLE
+    if (a->priority == b->priority)
+    {
+        before = ((int32_t)(a->seq - b->seq) < 0);
+    }
+#endif
+
+    return before;
+}
+
+/**
+ * @brief Address of an element slot.
+ *
+ * @param[in] q     Queue instance.
+ * @param[in] index Slot index (< capacity).
+ *
+ * @return Pointer to the first byte of the slot.
+ */
+static uint8_t *prio_slot(const queue_prio_t *q, uint16_t index)
+{
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+    uint8_t *base = (uint8_t *)q->buffer;
+
+    return &base[(uint32_t)index * (uint32_t)q->buffer_element_size];
+}
+
+/**
+ * @brief Move key and element from slot `src` to slot `dst`.
+ *
+ * @param[in,out] q   Queue instance.
+ * @param[in]     dst Destination slot.
+ * @param[in]     src Source slot.
+ */
+static void prio_move(queue_prio_t *q, uint16_t dst, uint16_t src)
+{
+    q->keys[dst] = q->keys[src];
+    queue_copy_bytes(prio_slot(q, dst), prio_slot(q, src), q->buffer_element_size);
+}
+
+/**
+ * @brief Sink a hole from the root until `key` may be placed in it.
+ *
+ * @param[in,out] q   Queue instance; `count` is the size without `key`'s slot.
+ * @param[in]     key Key of the element that will fill the hole.
+ *
+ * @return Final hole index (< count).
+ */
+static uint16_t prio_sift_down(queue_prio_t *q, const queue_prio_key_t *key)
+{
+    uint32_t hole = 0U;
+    bool sifting = true;
+
+    while (sifting)
+    {
+        uint32_t child = (2U * hole) + 1U;
+
+        if ((child + 1U) < (uint32_t)q->count)
+        {
+            if (prio_before(&q->keys[child + 1U], &q->keys[child]))
+            {
+                child++;
+            }
+        }
+
+        if ((child < (uint32_t)q->count) && prio_before(&q->keys[child], key))
+        {
+            prio_move(q, (uint16_t)hole, (uint16_t)child);
+            hole = child;
+        }
+        else
+        {
+            sifting = false;
+        }
+    }
+
+    return (uint16_t)hole;
+}
+
+/** @} */ /* end of queue_internal group */
@@ -0,0 +1,176 @@
+/**
+ * @file queue_prio.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Deterministic fixed-capacity priority queue (binary heap).
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Sibling of the generic FIFO queue for dispatching by urgency: instead of
+ *  one queue_t per priority level, all elements share a single binary heap.
+ *
+ *  The implementation:
+ *  - serves the smallest priority value first (0 = most urgent),
+ *  - keeps elements with equal priority in FIFO order when
+ *    @ref QUEUE_CFG_PRIO_STABLE is 1 (default),
+ *  - runs push/pop in O(log n) iterations without recursion, moving each
+ *    displaced element exactly once (hole technique),
+ *  - stores element data in a caller-supplied buffer and the ordering keys
+ *    in a caller-supplied key array,
+ *  - avoids dynamic memory allocation and standard library dependencies.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4) applies to the element copy.
+ */
+
+#ifndef QUEUE_PRIO_H
+#define QUEUE_PRIO_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Keep FIFO order among elements of equal priority.
+ *
+ * 1 (default) — every key carries an insertion sequence number (+4 bytes per slot).
+ * 0           — equal priorities are served in unspecified order.
+ *
+ * @note Must have the same value for the library and all its users.
+ */
+#ifndef QUEUE_CFG_PRIO_STABLE
+#define QUEUE_CFG_PRIO_STABLE 1
+#endif
+
+    /**
+     * @ingroup queue
+     * @brief Ordering key stored for every heap slot.
+     */
+    typedef struct
+    {
+        uint16_t priority; /**< Smaller value is served first. */
+#if QUEUE_CFG_PRIO_STABLE
+        uint32_t seq; /**< Insertion sequence number (tie-breaker). */
+#endif
+    } queue_prio_key_t;
+
+    /**
+     * @ingroup queue
+     * @brief Caller-supplied storage of a priority queue.
+     */
+    typedef struct
+    {
+        void *buffer;           /**< Element storage (buffer_element_size × capacity bytes). */
+        queue_prio_key_t *keys; /**< Key array (capacity entries). */
+    } queue_prio_storage_t;
+
+    /**
+     * @ingroup queue
+     * @brief Priority queue control structure.
+     *
+     * @details Slot 0 holds the most urgent element; slot i has children 2i+1 and 2i+2.
+     */
+    typedef struct
+    {
+        void *buffer;                 /**< Pointer to user-provided data buffer. */
+        queue_prio_key_t *keys;       /**< Pointer to user-provided key array. */
+        uint16_t buffer_element_size; /**< Element size in bytes (> 0). */
+        uint16_t capacity;            /**< Maximum number of elements (> 0). */
+        uint16_t count;               /**< Current number of stored elements. */
+#if QUEUE_CFG_PRIO_STABLE
+        uint32_t next_seq; /**< Sequence number of the next push. */
+#endif
+    } queue_prio_t;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a priority queue instance.
+     *
+     * @param[in,out] q            Pointer to queue control structure.
+     * @param[in]     storage      Element buffer and key array (both non-NULL).
+     * @param[in]     buffer_element_size Element size in bytes (must > 0).
+     * @param[in]     queue_capacity Number of elements in queue (must > 0).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments (NULL or 0).
+     */
+    queue_status_t queue_prio_init(queue_prio_t *q, const queue_prio_storage_t *storage, uint16_t buffer_element_size,
+                                   uint16_t queue_capacity);
+
+    /**
+     * @ingroup queue
+     * @brief Insert one element with the given priority.
+     *
+     * @param[in,out] q        Pointer to queue instance.
+     * @param[in]     item     Pointer to element data to add.
+     * @param[in]     priority Priority (0 = most urgent).
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_FULL  Queue already full.
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic, at most log2(capacity) element moves.
+     */
+    queue_status_t queue_prio_push(queue_prio_t *q, const void *item, uint16_t priority);
+
+    /**
+     * @ingroup queue
+     * @brief Remove the most urgent element.
+     *
+     * @param[in,out] q        Pointer to queue instance.
+     * @param[out]    item     Pointer to destination buffer to store element.
+     * @param[out]    priority Priority of the removed element (may be NULL).
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_EMPTY Queue empty — no element available (item unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic, at most log2(capacity) element moves.
+     */
+    queue_status_t queue_prio_pop(queue_prio_t *q, void *item, uint16_t *priority);
+
+    /**
+     * @ingroup queue
+     * @brief Copy the most urgent element without removing it.
+     *
+     * @param[in]  q        Pointer to queue instance.
+     * @param[out] item     Pointer to destination buffer to store element.
+     * @param[out] priority Priority of the element (may be NULL).
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_EMPTY Queue empty — no element available (item unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_prio_peek(const queue_prio_t *q, void *item, uint16_t *priority);
+
+    /**
+     * @ingroup queue
+     * @brief Check if priority queue is empty.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue empty or q is NULL.
+     * @return false — otherwise.
+     */
+    bool queue_prio_is_empty(const queue_prio_t *q);
+
+    /**
+     * @ingroup queue
+     * @brief Check if priority queue is full.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue full.
+     * @return false — otherwise (including q is NULL).
+     */
+    bool queue_prio_is_full(const queue_prio_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_PRIO_H */
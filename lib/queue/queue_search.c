@@ -0,0 +1,453 @@
+/**
+ * @file queue_search.c
+ * @brief Bulk key search, count and removal over the elements of a generic queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  The stored elements form at most two contiguous segments: from `head` to
+ *  the wrap point (the queue_read_span() region) and the rest from the start
+ *  of `buffer`. Each segment is scanned separately.
+ *
+ *  For packed keys a segment is a plain array of 1/2/4-byte integers, and
+ *  one vector compare produces a 16-bit mask with one bit per byte, set for
+ *  every byte of a matching lane (SSE2 `movemask`, MVE predicate, or the
+ *  NEON bit-weight reduction). The first match is `ctz(mask) / width`, the
+ *  match count `popcount(mask) / width`.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
+ *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
+ *
+ *  MISRA Deviation: DV-QUEUE-002 (Rule 11.3)
+ *  Controlled cast from `uint8_t*` to vector pointers for unaligned
+ *  16-byte loads.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_search.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+#if QUEUE_CFG_SEARCH_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define QUEUE_SEARCH_VECTOR 1
+#elif QUEUE_CFG_SEARCH_SIMD && defined(__ARM_FEATURE_MVE) && ((__ARM_FEATURE_MVE & 1) != 0)
+#include <arm_mve.h>
+#define QUEUE_SEARCH_VECTOR 1
+#elif QUEUE_CFG_SEARCH_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define QUEUE_SEARCH_VECTOR 1
+#else
+#define QUEUE_SEARCH_VECTOR 0
+#endif
+
+/** @brief Bytes compared per vector step. */
+#define QUEUE_SEARCH_BLOCK (16U)
+
+/* Validated key description shared by the scan helpers. */
+typedef struct
+{
+    uint32_t offset; /* key offset inside the element */
+    uint32_t width;  /* key width: 1, 2 or 4 */
+    uint32_t stride; /* element size */
+    uint32_t value;  /* key value truncated to width */
+} search_spec_t;
+
+static bool search_spec_init(search_spec_t *s, const queue_t *q, const queue_search_key_t *key, uint32_t value);
+static uint32_t search_first(const uint8_t *seg, uint32_t n, const search_spec_t *s);
+static uint32_t search_count(const uint8_t *seg, uint32_t n, const search_spec_t *s);
+static uint32_t search_find_offset(const queue_t *q, const search_spec_t *s);
+static bool search_match(const uint8_t *element, const search_spec_t *s);
+static uint32_t search_index(const queue_t *q, uint32_t offset);
+static uint8_t *search_slot(const queue_t *q, uint32_t offset);
+#if QUEUE_SEARCH_VECTOR
+static uint32_t search_mask16(const uint8_t *p, const search_spec_t *s);
+#endif
+
+/* -------------------------- */
+/* Queue search API           */
+/* -------------------------- */
+
+queue_status_t queue_find(const queue_t *q, const queue_search_key_t *key, uint32_t value, queue_index_t *offset)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    search_spec_t s;
+
+    if ((offset == NULL) || !search_spec_init(&s, q, key, value))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint32_t hit = search_find_offset(q, &s);
+
+        if (hit >= (uint32_t)q->count)
+        {
+            ret_status = QUEUE_EMPTY;
+        }
+        else
+        {
+            *offset = (queue_index_t)hit;
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_count_if(const queue_t *q, const queue_search_key_t *key, uint32_t value, queue_index_t *matches)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    search_spec_t s;
+
+    if ((matches == NULL) || !search_spec_init(&s, q, key, value))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint32_t first_n = (uint32_t)q->capacity - (uint32_t)q->head;
+        const uint32_t n0 = ((uint32_t)q->count < first_n) ? (uint32_t)q->count : first_n;
+
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise access */
+        *matches = (queue_index_t)(search_count(search_slot(q, 0U), n0, &s) +
+                                   search_count((const uint8_t *)q->buffer, (uint32_t)q->count - n0, &s));
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_remove_if(queue_t *q, const queue_search_key_t *key, uint32_t value, queue_index_t *removed)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    search_spec_t s;
+
+    if ((removed == NULL) || !search_spec_init(&s, q, key, value))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint32_t count = (uint32_t)q->count;
+        uint32_t kept = search_find_offset(q, &s);
+
+        for (uint32_t read = kept + 1U; read < count; read++)
+        {
+            const uint8_t *src = search_slot(q, read);
+
+            if (!search_match(src, &s))
+            {
+                queue_copy_in(q, search_slot(q, kept), src, s.stride);
+                kept++;
+            }
+        }
+
+        *removed = (queue_index_t)(count - kept);
+        q->count = (queue_index_t)kept;
+        q->tail = (queue_index_t)search_index(q, kept);
+#if QUEUE_CFG_STATS
+        q->stats.pops += (count - kept);
+#endif
+#if QUEUE_CFG_SNAPSHOT
+        /* survivors moved: a delta snapshot of this state would not replay */
+        q->rewrites += (kept < count) ? 1U : 0U;
+#endif
+    }
+
+    return ret_status;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Validate a key location and build the scan description.
+ *
+ * @param[out] s     Scan description.
+ * @param[in]  q     Queue instance (may be NULL).
+ * @param[in]  key   Key location (may be NULL).
+ * @param[in]  value Key value.
+ *
+ * @return true if the queue and key are usable.
+ */
+static bool search_spec_init(search_spec_t *s, const queue_t *q, const queue_search_key_t *key, uint32_t value)
+{
+    bool valid = (q != NULL) && (key != NULL);
+
+    if (valid)
+    {
+        const uint32_t width = (uint32_t)key->width;
+
+        valid = ((width == 1U) || (width == 2U) || (width == 4U)) &&
+                (((uint32_t)key->offset + width) <= (uint32_t)q->buffer_element_size);
+        s->offset = (uint32_t)key->offset;
+        s->width = width;
+        s->stride = (uint32_t)q->buffer_element_size;
+        s->value = (width == 4U) ? value : (value & (((uint32_t)1U << (8U * width)) - 1U));
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Index of the first match in a contiguous segment.
+ *
+ * @param[in] seg First element of the segment.
+ * @param[in] n   Number of elements in the segment.
+ * @param[in] s   Scan description.
+ *
+ * @return Index of the first matching element, `n` if none.
+ */
+static uint32_t search_first(const uint8_t *seg, uint32_t n, const search_spec_t *s)
+{
+    uint32_t i = 0U;
+    uint32_t found = n;
+
+#if QUEUE_SEARCH_VECTOR
+    if (s->stride == s->width)
+    {
+        const uint32_t per_block = QUEUE_SEARCH_BLOCK / s->width;
+
+        while ((found == n) && ((i + per_block) <= n))
+        {
+            const uint32_t mask = search_mask16(&seg[i * s->stride], s);
+
+            if (mask != 0U)
+            {
+                found = i + ((uint32_t)__builtin_ctz(mask) / s->width);
+            }
+            else
+            {
+                i += per_block;
+            }
+        }
+    }
+#endif
+
+    while ((found == n) && (i < n))
+    {
+        if (search_match(&seg[i * s->stride], s))
+        {
+            found = i;
+        }
+        i++;
+    }
+
+    return found;
+}
+
+/**
+ * @brief Number of matches in a contiguous segment.
+ *
+ * @param[in] seg First element of the segment.
+ * @param[in] n   Number of elements in the segment.
+ * @param[in] s   Scan description.
+ *
+ * @return Number of matching elements (<= n).
+ */
+static uint32_t search_count(const uint8_t *seg, uint32_t n, const search_spec_t *s)
+{
+    uint32_t i = 0U;
+    uint32_t matches = 0U;
+
+#if QUEUE_SEARCH_VECTOR
+    if (s->stride == s->width)
+    {
+        const uint32_t per_block = QUEUE_SEARCH_BLOCK / s->width;
+
+        for (; (i + per_block) <= n; i += per_block)
+        {
+            matches += (uint32_t)__builtin_popcount(search_mask16(&seg[i * s->stride], s)) / s->width;
+        }
+    }
+#endif
+
+    for (; i < n; i++)
+    {
+        if (search_match(&seg[i * s->stride], s))
+        {
+            matches++;
+        }
+    }
+
+    return matches;
+}
+
+/**
+ * @brief Position (from head) of the oldest match over both segments.
+ *
+ * @param[in] q Queue instance.
+ * @param[in] s Scan description.
+ *
+ * @return Offset of the first match, `count` if none.
+ */
+static uint32_t search_find_offset(const queue_t *q, const search_spec_t *s)
+{
+    const uint32_t first_n = (uint32_t)q->capacity - (uint32_t)q->head;
+    const uint32_t n0 = ((uint32_t)q->count < first_n) ? (uint32_t)q->count : first_n;
+    uint32_t hit = search_first(search_slot(q, 0U), n0, s);
+
+    if (hit == n0)
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise access */
+        hit = n0 + search_first((const uint8_t *)q->buffer, (uint32_t)q->count - n0, s);
+    }
+
+    return hit;
+}
+
+/**
+ * @brief Compare the key of one element.
+ *
+ * @param[in] element First byte of the element.
+ * @param[in] s       Scan description.
+ *
+ * @return true if the key equals `s->value`.
+ */
+static bool search_match(const uint8_t *element, const search_spec_t *s)
+{
+    union
+    {
+        uint8_t b[4];
+        uint16_t h;
+        uint32_t w;
+    } key;
+    uint32_t loaded = 0U;
+
+    for (uint32_t i = 0U; i < s->width; i++)
+    {
+        key.b[i] = element[s->offset + i];
+    }
+
+    if (s->width == 1U)
+    {
+        loaded = (uint32_t)key.b[0];
+    }
+    else if (s->width == 2U)
+    {
+        loaded = (uint32_t)key.h;
+    }
+    else
+    {
+        loaded = key.w;
+    }
+
+    return loaded == s->value;
+}
+
+/**
+ * @brief Slot index of a logical position.
+ *
+ * @param[in] q      Queue instance.
+ * @param[in] offset Position counted from head (<= capacity).
+ *
+ * @return (head + offset) mod capacity.
+ */
+static uint32_t search_index(const queue_t *q, uint32_t offset)
+{
+    uint32_t index = (uint32_t)q->head + offset;
+
+    if (index >= (uint32_t)q->capacity)
+    {
+        index -= (uint32_t)q->capacity;
+    }
+
+    return index;
+}
+
+/**
+ * @brief Address of the element at a logical position.
+ *
+ * @param[in] q      Queue instance.
+ * @param[in] offset Position counted from head (< capacity).
+ *
+ * @return Pointer to the first byte of the slot.
+ */
+static uint8_t *search_slot(const queue_t *q, uint32_t offset)
+{
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise access */
+    uint8_t *base = (uint8_t *)q->buffer;
+
+    return &base[search_index(q, offset) * (uint32_t)q->buffer_element_size];
+}
+
+#if QUEUE_SEARCH_VECTOR
+/**
+ * @brief Compare 16 bytes of packed keys.
+ *
+ * @param[in] p First byte of the block (no alignment required).
+ * @param[in] s Scan description (`width` == `stride`).
+ *
+ * @return Byte mask: bit i set if byte i belongs to a matching key.
+ */
+static uint32_t search_mask16(const uint8_t *p, const search_spec_t *s)
+{
+#if defined(__SSE2__)
+    /* MISRA Deviation DV-QUEUE-002: unaligned vector load */
+    const __m128i data = _mm_loadu_si128((const __m128i *)(const void *)p);
+    __m128i eq;
+
+    if (s->width == 1U)
+    {
+        eq = _mm_cmpeq_epi8(data, _mm_set1_epi8((char)s->value));
+    }
+    else if (s->width == 2U)
+    {
+        eq = _mm_cmpeq_epi16(data, _mm_set1_epi16((short)s->value));
+    }
+    else
+    {
+        eq = _mm_cmpeq_epi32(data, _mm_set1_epi32((int)s->value));
+    }
+
+    return (uint32_t)_mm_movemask_epi8(eq);
+#elif defined(__ARM_FEATURE_MVE)
+    mve_pred16_t eq;
+
+    if (s->width == 1U)
+    {
+        eq = vcmpeqq_n_u8(vld1q_u8(p), (uint8_t)s->value);
+    }
+    else if (s->width == 2U)
+    {
+        /* MISRA Deviation DV-QUEUE-002: lane-typed vector load */
+        eq = vcmpeqq_n_u16(vld1q_u16((const uint16_t *)(const void *)p), (uint16_t)s->value);
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-002: lane-typed vector load */
+        eq = vcmpeqq_n_u32(vld1q_u32((const uint32_t *)(const void *)p), s->value);
+    }
+
+    return (uint32_t)eq;
+#else
+    static const uint8_t bit_weights[16] = {1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U};
+    const uint8x16_t data = vld1q_u8(p);
+    uint8x16_t eq;
+
+    if (s->width == 1U)
+    {
+        eq = vceqq_u8(data, vdupq_n_u8((uint8_t)s->value));
+    }
+    else if (s->width == 2U)
+    {
+        eq = vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(data), vdupq_n_u16((uint16_t)s->value)));
+    }
+    else
+    {
+        eq = vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(data), vdupq_n_u32(s->value)));
+    }
+
+    eq = vandq_u8(eq, vld1q_u8(bit_weights));
+
+    return (uint32_t)vaddv_u8(vget_low_u8(eq)) | ((uint32_t)vaddv_u8(vget_high_u8(eq)) << 8U);
+#endif
+}
+#endif
+
+/** @} */ /* end of queue_internal group */
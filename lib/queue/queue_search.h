@@ -0,0 +1,110 @@
+/**
+ * @file queue_search.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Bulk key search, count and removal over the elements of a generic queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Answers "is there a queued element whose key equals X" (de-duplication,
+ *  cancellation) in place, without popping elements through the copy engine.
+ *  A key is a 1-, 2- or 4-byte unsigned integer at a fixed offset inside the
+ *  element, compared in native byte order.
+ *
+ *  The implementation:
+ *  - walks the stored elements as the two contiguous segments of `buffer`
+ *    (before and after the wrap point),
+ *  - for packed keys (element size equal to the key width) compares 16 bytes
+ *    per step with SSE2 (x86), NEON (AArch64) or Helium/MVE (Armv8.1-M)
+ *    when the compiler targets them and @ref QUEUE_CFG_SEARCH_SIMD is 1,
+ *  - uses a scalar loop for strided keys, segment tails and all other targets,
+ *  - removes matches by compacting the survivors towards `head`, keeping
+ *    their FIFO order.
+ */
+
+#ifndef QUEUE_SEARCH_H
+#define QUEUE_SEARCH_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Use vector compares for packed keys where the target supports them.
+ *
+ * 1 (default) — SSE2 / AArch64 NEON / MVE selected from the compiler's target macros.
+ * 0           — scalar loop on every target.
+ */
+#ifndef QUEUE_CFG_SEARCH_SIMD
+#define QUEUE_CFG_SEARCH_SIMD 1
+#endif
+
+    /**
+     * @ingroup queue
+     * @brief Location of the search key inside an element.
+     */
+    typedef struct
+    {
+        uint16_t offset; /**< Byte offset of the key inside the element. */
+        uint8_t width;   /**< Key width in bytes: 1, 2 or 4. */
+    } queue_search_key_t;
+
+    /**
+     * @ingroup queue
+     * @brief Find the oldest element whose key equals `value`.
+     *
+     * @param[in]  q      Pointer to queue instance.
+     * @param[in]  key    Key location (offset + width <= element size).
+     * @param[in]  value  Key value (truncated to the key width).
+     * @param[out] offset Position of the match counted from head (usable with queue_peek_at()).
+     *
+     * @retval QUEUE_OK    Match found.
+     * @retval QUEUE_EMPTY No element matches (offset unchanged).
+     * @retval QUEUE_ERROR Invalid parameters or key location.
+     */
+    queue_status_t queue_find(const queue_t *q, const queue_search_key_t *key, uint32_t value, queue_index_t *offset);
+
+    /**
+     * @ingroup queue
+     * @brief Count the elements whose key equals `value`.
+     *
+     * @param[in]  q       Pointer to queue instance.
+     * @param[in]  key     Key location.
+     * @param[in]  value   Key value.
+     * @param[out] matches Number of matching elements.
+     *
+     * @retval QUEUE_OK    `*matches` written (may be 0).
+     * @retval QUEUE_ERROR Invalid parameters or key location.
+     */
+    queue_status_t queue_count_if(const queue_t *q, const queue_search_key_t *key, uint32_t value, queue_index_t *matches);
+
+    /**
+     * @ingroup queue
+     * @brief Remove every element whose key equals `value`.
+     *
+     * @param[in,out] q       Pointer to queue instance.
+     * @param[in]     key     Key location.
+     * @param[in]     value   Key value.
+     * @param[out]    removed Number of removed elements.
+     *
+     * @retval QUEUE_OK    `*removed` written (may be 0).
+     * @retval QUEUE_ERROR Invalid parameters or key location.
+     *
+     * @note Elements before the first match are not moved; each survivor
+     *       after it is copied once. Removed elements count as pops in the
+     *       statistics.
+     */
+    queue_status_t queue_remove_if(queue_t *q, const queue_search_key_t *key, uint32_t value, queue_index_t *removed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_SEARCH_H */
@@ -0,0 +1,173 @@
+/**
+ * @file queue_set.c
+ * @brief Fan-in dispatcher over several generic FIFO queues.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Member `m` maps to bit `31 − m` of the ready bitmap. Selection is one
+ *  count-leading-zeros (queue_clz32(): the CLZ instruction where the
+ *  compiler provides it, a fixed five-step binary search otherwise).
+ *
+ * @ingroup queue
+ */
+
+#include "queue_set.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+static bool set_member_valid(const queue_set_t *set, uint8_t member);
+static uint32_t set_bit(uint8_t member);
+
+/* -------------------------- */
+/* Queue set API              */
+/* -------------------------- */
+
+queue_status_t queue_set_init(queue_set_t *set, queue_t *const *members, uint8_t member_count)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((set == NULL) || (members == NULL) || (member_count == 0U) || (member_count > QUEUE_SET_MAX_MEMBERS))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        set->members = members;
+        set->member_count = member_count;
+        set->ready = 0U;
+
+        for (uint8_t m = 0U; (m < member_count) && (ret_status == QUEUE_OK); m++)
+        {
+            ret_status = queue_set_sync(set, m);
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_set_push(queue_set_t *set, uint8_t member, const void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (!set_member_valid(set, member))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        ret_status = queue_push(set->members[member], item);
+        if (ret_status == QUEUE_OK)
+        {
+            set->ready |= set_bit(member);
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_set_next(const queue_set_t *set, uint8_t *member)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((set == NULL) || (member == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (set->ready == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        *member = queue_clz32(set->ready);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_set_pop(queue_set_t *set, void *item, uint8_t *member)
+{
+    uint8_t selected = 0U;
+    queue_status_t ret_status = queue_set_next(set, &selected);
+
+    if ((ret_status == QUEUE_OK) && ((item == NULL) || (member == NULL)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (ret_status == QUEUE_OK)
+    {
+        queue_t *q = set->members[selected];
+
+        ret_status = queue_pop(q, item);
+        if (ret_status == QUEUE_OK)
+        {
+            *member = selected;
+        }
+        if (queue_is_empty(q))
+        {
+            set->ready &= ~set_bit(selected);
+        }
+    }
+    else
+    {
+        /* QUEUE_EMPTY or QUEUE_ERROR from queue_set_next() */
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_set_sync(queue_set_t *set, uint8_t member)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (!set_member_valid(set, member))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (queue_is_empty(set->members[member]))
+    {
+        set->ready &= ~set_bit(member);
+    }
+    else
+    {
+        set->ready |= set_bit(member);
+    }
+
+    return ret_status;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Check that `member` names a registered, non-NULL queue.
+ *
+ * @param[in] set    Set instance (may be NULL).
+ * @param[in] member Member index.
+ *
+ * @return true if the set and member are usable.
+ */
+static bool set_member_valid(const queue_set_t *set, uint8_t member)
+{
+    return (set != NULL) && (member < set->member_count) && (set->members[member] != NULL);
+}
+
+/**
+ * @brief Ready-bitmap bit owned by a member.
+ *
+ * @param[in] member Member index (< QUEUE_SET_MAX_MEMBERS).
+ *
+ * @return `0x80000000 >> member`.
+ */
+static uint32_t set_bit(uint8_t member)
+{
+    return 0x80000000U >> member;
+}
+
+/** @} */ /* end of queue_internal group */
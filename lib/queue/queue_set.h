@@ -0,0 +1,134 @@
+/**
+ * @file queue_set.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Fan-in dispatcher over several generic FIFO queues.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Replaces the per-iteration queue_is_empty() sweep of a main loop that owns
+ *  many queue_t instances with a ready bitmap: one bit per member queue, set
+ *  on the empty → non-empty transition of a push and cleared when a pop
+ *  drains the queue.
+ *
+ *  The implementation:
+ *  - treats the member array order as priority (member 0 is served first),
+ *  - selects the most urgent non-empty member with one count-leading-zeros
+ *    operation, so dispatch cost does not depend on the number of members,
+ *  - supports up to @ref QUEUE_SET_MAX_MEMBERS queues,
+ *  - keeps the members' own queue_t API usable; queue_set_sync() re-reads
+ *    a member whose contents were changed behind the set's back.
+ *
+ * @note
+ *  The bitmap is updated with plain read-modify-write: all set operations
+ *  must run in one context, or under the caller's critical section.
+ */
+
+#ifndef QUEUE_SET_H
+#define QUEUE_SET_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Maximum number of member queues (width of the ready bitmap). */
+#define QUEUE_SET_MAX_MEMBERS 32U
+
+    /**
+     * @ingroup queue
+     * @brief Queue set control structure.
+     *
+     * @details Member `m` owns bit `31 − m` of `ready`, so the leading-zero
+     *          count of `ready` is the most urgent ready member.
+     */
+    typedef struct
+    {
+        queue_t *const *members; /**< Caller-supplied member array, in priority order. */
+        uint32_t ready;          /**< Ready bitmap: bit set ⇔ member not empty. */
+        uint8_t member_count;    /**< Number of members (1..QUEUE_SET_MAX_MEMBERS). */
+    } queue_set_t;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a queue set over already initialized queues.
+     *
+     * @param[out] set          Pointer to set control structure.
+     * @param[in]  members      Array of `member_count` queue pointers (non-NULL
+     *                          entries); index 0 has the highest priority.
+     * @param[in]  member_count Number of members (1..QUEUE_SET_MAX_MEMBERS).
+     *
+     * @retval QUEUE_OK    Initialization succeeded; `ready` reflects the members' current state.
+     * @retval QUEUE_ERROR Invalid arguments.
+     *
+     * @note The member array must stay valid for the lifetime of the set.
+     */
+    queue_status_t queue_set_init(queue_set_t *set, queue_t *const *members, uint8_t member_count);
+
+    /**
+     * @ingroup queue
+     * @brief Push one element into a member queue and mark it ready.
+     *
+     * @param[in,out] set    Pointer to set instance.
+     * @param[in]     member Member index.
+     * @param[in]     item   Pointer to element data to add.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_FULL  Member queue full.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_set_push(queue_set_t *set, uint8_t member, const void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Find the most urgent non-empty member without removing anything.
+     *
+     * @param[in]  set    Pointer to set instance.
+     * @param[out] member Index of the selected member.
+     *
+     * @retval QUEUE_OK    `*member` holds the selected member.
+     * @retval QUEUE_EMPTY All members empty (member unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note O(1): one count-leading-zeros of the ready bitmap.
+     */
+    queue_status_t queue_set_next(const queue_set_t *set, uint8_t *member);
+
+    /**
+     * @ingroup queue
+     * @brief Pop one element from the most urgent non-empty member.
+     *
+     * @param[in,out] set    Pointer to set instance.
+     * @param[out]    item   Destination buffer, large enough for the largest
+     *                       member element.
+     * @param[out]    member Index of the member the element came from.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_EMPTY All members empty (item and member unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_set_pop(queue_set_t *set, void *item, uint8_t *member);
+
+    /**
+     * @ingroup queue
+     * @brief Re-read the state of one member after direct queue_t calls.
+     *
+     * @param[in,out] set    Pointer to set instance.
+     * @param[in]     member Member index.
+     *
+     * @retval QUEUE_OK    Ready bit updated.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_set_sync(queue_set_t *set, uint8_t member);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_SET_H */
@@ -0,0 +1,341 @@
+/**
+ * @file queue_shm.c
+ * @brief Shared-memory MPMC FIFO queue implementation.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Region layout (offsets from the region base, each part 8-byte aligned):
+ *
+ *      [ queue_shm_header_t | seq[capacity] | element storage ]
+ *
+ *  The offsets are derived from the geometry alone, so queue_shm_attach()
+ *  recomputes them and rejects a header that disagrees (corruption, another
+ *  layout version, or a build with different cache-line settings).
+ *  The checked geometry is copied into the process-local handle; push and pop
+ *  never read it from the shared header again, so a later write to the header
+ *  cannot move an access outside the validated layout.
+ *  Push and pop follow the slot sequence protocol of queue_mpmc.c on
+ *  `header->tail` / `header->head`, using the same queue_mpmc_claim() from
+ *  queue_internal.h.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
+ *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
+ *  Controlled casts from region bytes to the header and sequence types at
+ *  offsets validated against the region size and alignment.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_shm.h"
+#include "queue_internal.h"
+
+#if !defined(QUEUE_ATOMIC_CAS_RELAXED)
+#error "queue_shm requires C11 atomics or the GCC/Clang __atomic builtins"
+#elif QUEUE_CFG_USE_C11_ATOMICS && (ATOMIC_INT_LOCK_FREE != 2)
+#error "queue_shm requires lock-free 32-bit atomics"
+#elif defined(__GCC_ATOMIC_INT_LOCK_FREE) && (__GCC_ATOMIC_INT_LOCK_FREE != 2)
+#error "queue_shm requires lock-free 32-bit atomics"
+#endif
+
+/** @brief Alignment of every part of the region. */
+#define SHM_PART_ALIGN 8U
+
+/**
+ * @brief Offsets and size of a region for one geometry.
+ */
+typedef struct
+{
+    uint32_t seq_offset;  /**< Offset of the sequence array. */
+    uint32_t data_offset; /**< Offset of the element storage. */
+    uint32_t size;        /**< Total region size. */
+} shm_layout_t;
+
+static bool shm_layout(uint16_t element_size, uint32_t capacity, shm_layout_t *layout);
+static uint64_t shm_align_up(uint64_t value);
+static bool shm_region_aligned(const void *region);
+static bool shm_header_valid(queue_shm_header_t *header, size_t region_size, queue_shm_config_t *geometry,
+                             shm_layout_t *layout);
+static void shm_bind(queue_shm_t *q, void *region, const queue_shm_config_t *geometry, const shm_layout_t *layout);
+static bool shm_claim(const queue_shm_t *q, queue_mpmc_atomic_t *index, uint32_t expect_offset, uint32_t *claimed);
+
+/* -------------------------- */
+/* Shared-memory queue API    */
+/* -------------------------- */
+
+size_t queue_shm_region_size(const queue_shm_config_t *cfg)
+{
+    shm_layout_t layout;
+    size_t size = 0U;
+
+    if ((cfg != NULL) && shm_layout(cfg->element_size, cfg->capacity, &layout))
+    {
+        size = (size_t)layout.size;
+    }
+
+    return size;
+}
+
+queue_status_t queue_shm_create(queue_shm_t *q, void *region, size_t region_size, const queue_shm_config_t *cfg)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    shm_layout_t layout;
+
+    if ((q == NULL) || (region == NULL) || (cfg == NULL) || !shm_region_aligned(region))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (!shm_layout(cfg->element_size, cfg->capacity, &layout) || ((size_t)layout.size > region_size))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: region base holds the header (alignment checked) */
+        queue_shm_header_t *header = (queue_shm_header_t *)region;
+
+        QUEUE_ATOMIC_STORE_RELAXED(&header->magic, 0U);
+        header->version = (uint16_t)QUEUE_SHM_VERSION;
+        header->element_size = cfg->element_size;
+        header->capacity = cfg->capacity;
+        header->index_mask = cfg->capacity - 1U;
+        header->seq_offset = layout.seq_offset;
+        header->data_offset = layout.data_offset;
+        header->region_size = layout.size;
+        shm_bind(q, region, cfg, &layout);
+        for (uint32_t i = 0U; i < cfg->capacity; i++)
+        {
+            QUEUE_ATOMIC_STORE_RELAXED(&q->seq[i], i);
+        }
+        QUEUE_ATOMIC_STORE_RELAXED(&header->head, 0U);
+        QUEUE_ATOMIC_STORE_RELAXED(&header->tail, 0U);
+        QUEUE_ATOMIC_STORE_RELEASE(&header->magic, QUEUE_SHM_MAGIC);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_shm_attach(queue_shm_t *q, void *region, size_t region_size)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    queue_shm_config_t geometry;
+    shm_layout_t layout;
+
+    if ((q == NULL) || (region == NULL) || (region_size < sizeof(queue_shm_header_t)) || !shm_region_aligned(region))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    /* MISRA Deviation DV-QUEUE-001: region base holds the header (alignment and size checked) */
+    else if (!shm_header_valid((queue_shm_header_t *)region, region_size, &geometry, &layout))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        shm_bind(q, region, &geometry, &layout);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_shm_push(queue_shm_t *q, const void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    uint32_t index = 0U;
+
+    if ((q == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (!shm_claim(q, &q->header->tail, 0U, &index))
+    {
+        ret_status = QUEUE_FULL;
+    }
+    else
+    {
+        const uint32_t slot = index & q->index_mask;
+
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        queue_copy_bytes(&q->data[slot * (uint32_t)q->element_size], (const uint8_t *)item, q->element_size);
+        QUEUE_ATOMIC_STORE_RELEASE(&q->seq[slot], index + 1U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_shm_pop(queue_shm_t *q, void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    uint32_t index = 0U;
+
+    if ((q == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (!shm_claim(q, &q->header->head, 1U, &index))
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        const uint32_t slot = index & q->index_mask;
+
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        queue_copy_bytes((uint8_t *)item, &q->data[slot * (uint32_t)q->element_size], q->element_size);
+        QUEUE_ATOMIC_STORE_RELEASE(&q->seq[slot], index + q->capacity);
+    }
+
+    return ret_status;
+}
+
+bool queue_shm_is_empty(const queue_shm_t *q)
+{
+    bool is_empty = true;
+
+    if (q != NULL)
+    {
+        is_empty = (QUEUE_ATOMIC_LOAD_ACQUIRE(&q->header->head) == QUEUE_ATOMIC_LOAD_ACQUIRE(&q->header->tail));
+    }
+
+    return is_empty;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Compute the region layout of a geometry.
+ *
+ * @param[in]  element_size Element size in bytes.
+ * @param[in]  capacity     Number of slots.
+ * @param[out] layout       Offsets and total size.
+ *
+ * @return true if the geometry is valid and the region fits in 4 GiB.
+ */
+static bool shm_layout(uint16_t element_size, uint32_t capacity, shm_layout_t *layout)
+{
+    const uint64_t seq_offset = shm_align_up((uint64_t)sizeof(queue_shm_header_t));
+    const uint64_t data_offset = shm_align_up(seq_offset + ((uint64_t)capacity * sizeof(queue_mpmc_atomic_t)));
+    const uint64_t size = data_offset + ((uint64_t)capacity * (uint64_t)element_size);
+    bool valid = (element_size > 0U) && (capacity >= 2U) && ((capacity & (capacity - 1U)) == 0U);
+
+    if (valid && (size <= (uint64_t)UINT32_MAX))
+    {
+        layout->seq_offset = (uint32_t)seq_offset;
+        layout->data_offset = (uint32_t)data_offset;
+        layout->size = (uint32_t)size;
+    }
+    else
+    {
+        valid = false;
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Round up to the region part alignment.
+ *
+ * @param[in] value Byte offset.
+ *
+ * @return Smallest multiple of SHM_PART_ALIGN >= value.
+ */
+static uint64_t shm_align_up(uint64_t value)
+{
+    return (value + ((uint64_t)SHM_PART_ALIGN - 1U)) & ~((uint64_t)SHM_PART_ALIGN - 1U);
+}
+
+/**
+ * @brief Check the region base alignment.
+ *
+ * @param[in] region Region base.
+ *
+ * @return true if aligned to QUEUE_SHM_REGION_ALIGN.
+ */
+static bool shm_region_aligned(const void *region)
+{
+    /* MISRA Deviation DV-QUEUE-001: address inspected only for its alignment */
+    return (((uintptr_t)region) % (uintptr_t)QUEUE_SHM_REGION_ALIGN) == 0U;
+}
+
+/**
+ * @brief Validate the header of an existing region.
+ *
+ * @param[in]  header      Region base.
+ * @param[in]  region_size Mapped size of the region.
+ * @param[out] geometry    Geometry read from the header (valid on success).
+ * @param[out] layout      Layout recomputed from that geometry (valid on success).
+ *
+ * @return true if the region is published, of this layout version, and its
+ *         stored layout matches the one recomputed from its geometry and
+ *         fits in the mapping.
+ *
+ * @note The geometry is read once; only the returned copies are trusted.
+ */
+static bool shm_header_valid(queue_shm_header_t *header, size_t region_size, queue_shm_config_t *geometry,
+                             shm_layout_t *layout)
+{
+    bool valid = (QUEUE_ATOMIC_LOAD_ACQUIRE(&header->magic) == QUEUE_SHM_MAGIC) && (header->version == QUEUE_SHM_VERSION);
+
+    if (valid)
+    {
+        geometry->element_size = header->element_size;
+        geometry->capacity = header->capacity;
+        valid = shm_layout(geometry->element_size, geometry->capacity, layout);
+    }
+    if (valid)
+    {
+        valid = (header->seq_offset == layout->seq_offset) && (header->data_offset == layout->data_offset) &&
+                (header->region_size == layout->size) && (header->index_mask == (geometry->capacity - 1U)) &&
+                ((size_t)layout->size <= region_size);
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Fill the process-local handle from a validated geometry.
+ *
+ * @param[out] q        Handle.
+ * @param[in]  region   Region base.
+ * @param[in]  geometry Checked element size and capacity.
+ * @param[in]  layout   Layout of that geometry.
+ */
+static void shm_bind(queue_shm_t *q, void *region, const queue_shm_config_t *geometry, const shm_layout_t *layout)
+{
+    /* MISRA Deviation DV-QUEUE-001: controlled casts at validated offsets */
+    uint8_t *base = (uint8_t *)region;
+
+    q->header = (queue_shm_header_t *)region;
+    q->seq = (queue_mpmc_atomic_t *)&base[layout->seq_offset];
+    q->data = &base[layout->data_offset];
+    q->capacity = geometry->capacity;
+    q->index_mask = geometry->capacity - 1U;
+    q->element_size = geometry->element_size;
+}
+
+/**
+ * @brief Claim the next index of one side of the queue.
+ *
+ * @param[in]     q             Attached handle.
+ * @param[in,out] index         `header->tail` (producers) or `header->head` (consumers).
+ * @param[in]     expect_offset 0 for producers (slot free), 1 for consumers (slot full).
+ * @param[out]    claimed       Claimed index on success.
+ *
+ * @return true — index claimed, false — queue full (producers) / empty (consumers).
+ *
+ * @note Same protocol as queue_mpmc.c: queue_mpmc_claim() in queue_internal.h.
+ */
+static bool shm_claim(const queue_shm_t *q, queue_mpmc_atomic_t *index, uint32_t expect_offset, uint32_t *claimed)
+{
+    const queue_mpmc_side_t side = {q->seq, index, q->index_mask, expect_offset};
+
+    return queue_mpmc_claim(&side, 1U, claimed);
+}
+
+/** @} */ /* end of queue_internal group */
@@ -0,0 +1,204 @@
+/**
+ * @file queue_shm.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Position-independent MPMC FIFO queue for shared memory between processes.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Variant of the MPMC queue whose control block and element storage live in
+ *  one caller-supplied region (e.g. a `shm_open()` + `mmap()` mapping), so
+ *  several processes exchange fixed-size records without a syscall per
+ *  message.
+ *
+ *  The implementation:
+ *  - stores no pointers in the region: the sequence array and the element
+ *    storage are located by byte offsets from the region base, so every
+ *    process may map the region at a different address,
+ *  - starts the region with a header carrying a magic number, a layout
+ *    version and the geometry, checked by queue_shm_attach(),
+ *  - uses the same per-slot sequence protocol as @ref queue_mpmc_t, so it is
+ *    safe for any number of producers and consumers (SPSC included),
+ *  - keeps the process-local addresses in a small handle (@ref queue_shm_t)
+ *    filled by queue_shm_create() or queue_shm_attach(),
+ *  - avoids dynamic memory allocation and OS dependencies: mapping the region
+ *    is left to the caller.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4) applies to the element copy and
+ *  to the offset-based addressing inside the region.
+ *
+ * @note
+ *  The index and sequence counters must be lock-free 32-bit atomics, which
+ *  makes them address-free and usable across processes. All processes must
+ *  be built with the same @ref QUEUE_CFG_CACHE_LINE_ALIGN / size settings;
+ *  a mismatch is rejected by queue_shm_attach().
+ */
+
+#ifndef QUEUE_SHM_H
+#define QUEUE_SHM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include "queue_config.h"
+#include "queue_mpmc.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Header magic of an initialized region ("QSHM"). */
+#define QUEUE_SHM_MAGIC 0x5153484DU
+
+/** @brief Region layout version; bumped on every incompatible layout change. */
+#define QUEUE_SHM_VERSION 1U
+
+/** @brief Required alignment of the region base address in bytes. */
+#if QUEUE_CFG_CACHE_LINE_ALIGN
+#define QUEUE_SHM_REGION_ALIGN ((uint32_t)QUEUE_CFG_CACHE_LINE_SIZE)
+#else
+#define QUEUE_SHM_REGION_ALIGN 8U
+#endif
+
+    /**
+     * @ingroup queue
+     * @brief Control block at the start of a shared region.
+     *
+     * @details
+     *  All members other than the counters are written once by
+     *  queue_shm_create() before `magic` is published with release ordering.
+     *  Offsets are counted from the region base.
+     */
+    typedef struct
+    {
+        queue_mpmc_atomic_t magic;                    /**< @ref QUEUE_SHM_MAGIC once initialized, 0 before. */
+        uint16_t version;                             /**< @ref QUEUE_SHM_VERSION. */
+        uint16_t element_size;                        /**< Element size in bytes (> 0). */
+        uint32_t capacity;                            /**< Number of slots (power of two, >= 2). */
+        uint32_t index_mask;                          /**< capacity − 1. */
+        uint32_t seq_offset;                          /**< Offset of the sequence array (capacity entries). */
+        uint32_t data_offset;                         /**< Offset of the element storage. */
+        uint32_t region_size;                         /**< Bytes used by the queue, header included. */
+        QUEUE_CACHE_ALIGNED queue_mpmc_atomic_t head; /**< Next index to pop (consumers). */
+        QUEUE_CACHE_ALIGNED queue_mpmc_atomic_t tail; /**< Next index to push (producers). */
+    } queue_shm_header_t;
+
+    /**
+     * @ingroup queue
+     * @brief Geometry of a new shared queue.
+     */
+    typedef struct
+    {
+        uint16_t element_size; /**< Element size in bytes (> 0). */
+        uint32_t capacity;     /**< Number of elements (power of two, >= 2). */
+    } queue_shm_config_t;
+
+    /**
+     * @ingroup queue
+     * @brief Process-local handle of a shared queue.
+     *
+     * @note Holds addresses valid in the calling process only; never place it in the region.
+     */
+    typedef struct
+    {
+        queue_shm_header_t *header; /**< Region base. */
+        queue_mpmc_atomic_t *seq;   /**< Sequence array inside the region. */
+        uint8_t *data;              /**< Element storage inside the region. */
+        uint32_t capacity;          /**< Validated copy of `header->capacity`. */
+        uint32_t index_mask;        /**< capacity − 1. */
+        uint16_t element_size;      /**< Validated copy of `header->element_size`. */
+    } queue_shm_t;
+
+    /**
+     * @ingroup queue
+     * @brief Number of region bytes needed for a given geometry.
+     *
+     * @param[in] cfg Queue geometry.
+     *
+     * @return Region size in bytes, or 0 if the geometry is invalid or the
+     *         region would not fit in 4 GiB.
+     */
+    size_t queue_shm_region_size(const queue_shm_config_t *cfg);
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a new shared queue in `region`.
+     *
+     * @param[out]    q           Process-local handle.
+     * @param[in,out] region      Region base (aligned to @ref QUEUE_SHM_REGION_ALIGN).
+     * @param[in]     region_size Mapped size of the region in bytes.
+     * @param[in]     cfg         Queue geometry.
+     *
+     * @retval QUEUE_OK    Region initialized and published.
+     * @retval QUEUE_ERROR Invalid arguments, misaligned or too small region.
+     *
+     * @note Must complete before any other process pushes or pops. O(capacity).
+     */
+    queue_status_t queue_shm_create(queue_shm_t *q, void *region, size_t region_size, const queue_shm_config_t *cfg);
+
+    /**
+     * @ingroup queue
+     * @brief Attach to a shared queue created by another process.
+     *
+     * @param[out]    q           Process-local handle.
+     * @param[in,out] region      Base of the local mapping of the region.
+     * @param[in]     region_size Mapped size of the region in bytes.
+     *
+     * @retval QUEUE_OK    Handle filled; `q->header->element_size` gives the record size.
+     * @retval QUEUE_ERROR Invalid arguments, region not initialized, wrong
+     *                     magic or version, or a layout that does not match
+     *                     this build or does not fit in `region_size`.
+     */
+    queue_status_t queue_shm_attach(queue_shm_t *q, void *region, size_t region_size);
+
+    /**
+     * @ingroup queue
+     * @brief Try to push one element (any producer in any process).
+     *
+     * @param[in,out] q    Attached handle.
+     * @param[in]     item Pointer to element data (`element_size` bytes).
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_FULL  Queue full (never blocks).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Lock-free.
+     */
+    queue_status_t queue_shm_push(queue_shm_t *q, const void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Try to pop one element (any consumer in any process).
+     *
+     * @param[in,out] q    Attached handle.
+     * @param[out]    item Destination buffer (`element_size` bytes).
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_EMPTY Queue empty — item unchanged (never blocks).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Lock-free.
+     */
+    queue_status_t queue_shm_pop(queue_shm_t *q, void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Check if shared queue is empty.
+     *
+     * @param[in] q Attached handle.
+     * @return true  — queue empty or q is NULL.
+     * @return false — otherwise.
+     *
+     * @note The result is a snapshot; it may change as soon as another context runs.
+     */
+    bool queue_shm_is_empty(const queue_shm_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_SHM_H */
@@ -0,0 +1,398 @@
+/**
+ * @file queue_snapshot.c
+ * @brief Snapshot record export and restore for the generic queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  A record carries the newest `count` of the `live` elements stored in the
+ *  queue when it was written. A full record has `count` == `live`. A delta
+ *  record carries the elements pushed since the previous record, so the
+ *  `live − count` elements before them are the newest survivors of the
+ *  previous state; restore keeps those and drops the older ones.
+ *
+ *  The payload is read in place from at most two contiguous segments of the
+ *  queue buffer: once for the CRC, once for the write hook.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
+ *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_snapshot.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+/** @brief Header size in bytes. */
+#define SNAP_HEADER_SIZE ((uint32_t)sizeof(queue_snapshot_header_t))
+
+/**
+ * @brief Record payload as up to two contiguous runs of queue storage.
+ */
+typedef struct
+{
+    const uint8_t *data[2]; /**< Segment start (NULL if unused). */
+    uint32_t size[2];       /**< Segment size in bytes. */
+} snap_payload_t;
+
+static void snap_header_init(const queue_t *q, queue_snapshot_header_t *header, uint16_t kind, uint32_t count);
+static queue_status_t snap_emit(const queue_snapshot_t *s, queue_snapshot_header_t *header, uint32_t *written);
+static void snap_payload(const queue_t *q, uint32_t from, uint32_t count, snap_payload_t *payload);
+static queue_status_t snap_parse(const queue_t *q, const uint8_t *record, uint32_t size,
+                                 queue_snapshot_header_t *header);
+static bool snap_continues(const queue_t *q, const queue_snapshot_header_t *header);
+static uint32_t snap_crc(uint32_t crc, const uint8_t *data, uint32_t size);
+static void snap_mark(queue_snapshot_t *s);
+
+/* -------------------------- */
+/* Snapshot API               */
+/* -------------------------- */
+
+queue_status_t queue_snapshot_init(queue_snapshot_t *s, const queue_t *queue, const queue_snapshot_sink_t *sink)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((s == NULL) || (queue == NULL) || (sink == NULL) || (sink->write == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        s->queue = queue;
+        s->sink = *sink;
+#if QUEUE_CFG_SNAPSHOT
+        s->seq = 0U;
+        s->rewrites = 0U;
+        s->live = 0U;
+        s->has_base = false;
+#endif
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_snapshot_full(queue_snapshot_t *s, uint32_t *written)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (s == NULL)
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        queue_snapshot_header_t header;
+
+        snap_header_init(s->queue, &header, (uint16_t)QUEUE_SNAPSHOT_FULL, (uint32_t)s->queue->count);
+        ret_status = snap_emit(s, &header, written);
+        if (ret_status == QUEUE_OK)
+        {
+            snap_mark(s);
+        }
+    }
+
+    return ret_status;
+}
+
+#if QUEUE_CFG_SNAPSHOT
+queue_status_t queue_snapshot_delta(queue_snapshot_t *s, uint32_t *written)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (s == NULL)
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (!s->has_base || (s->queue->rewrites != s->rewrites))
+    {
+        ret_status = queue_snapshot_full(s, written);
+    }
+    else if ((s->queue->push_seq == s->seq) && (s->queue->count == s->live))
+    {
+        if (written != NULL)
+        {
+            *written = 0U;
+        }
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        const uint32_t pushed = s->queue->push_seq - s->seq;
+        const uint32_t live = (uint32_t)s->queue->count;
+        queue_snapshot_header_t header;
+
+        snap_header_init(s->queue, &header, (uint16_t)QUEUE_SNAPSHOT_DELTA, (pushed < live) ? pushed : live);
+        header.base_seq = s->seq;
+        ret_status = snap_emit(s, &header, written);
+        if (ret_status == QUEUE_OK)
+        {
+            snap_mark(s);
+        }
+    }
+
+    return ret_status;
+}
+#endif /* QUEUE_CFG_SNAPSHOT */
+
+queue_status_t queue_snapshot_restore(queue_t *q, const void *record, uint32_t size, uint32_t *used)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    queue_snapshot_header_t header;
+
+    if ((q == NULL) || (record == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise access */
+        const uint8_t *bytes = (const uint8_t *)record;
+        queue_index_t pushed = 0U;
+
+        ret_status = snap_parse(q, bytes, size, &header);
+        if ((ret_status == QUEUE_OK) && !snap_continues(q, &header))
+        {
+            ret_status = QUEUE_ERROR;
+        }
+        if (ret_status == QUEUE_OK)
+        {
+            const uint32_t survivors = header.live - header.count;
+
+            (void)queue_read_advance(q, (queue_index_t)((uint32_t)q->count - survivors));
+            (void)queue_push_n(q, &bytes[SNAP_HEADER_SIZE], (queue_index_t)header.count, &pushed);
+#if QUEUE_CFG_SNAPSHOT
+            q->push_seq = header.seq;
+#endif
+            if (used != NULL)
+            {
+                *used = SNAP_HEADER_SIZE + (header.count * header.element_size);
+            }
+        }
+    }
+
+    return ret_status;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Fill a record header for the current queue state (CRC left at 0).
+ *
+ * @param[in]  q      Exported queue.
+ * @param[out] header Header to fill.
+ * @param[in]  kind   Record kind.
+ * @param[in]  count  Number of payload elements (newest first counted from tail).
+ */
+static void snap_header_init(const queue_t *q, queue_snapshot_header_t *header, uint16_t kind, uint32_t count)
+{
+    header->magic = QUEUE_SNAPSHOT_MAGIC;
+    header->version = (uint16_t)QUEUE_SNAPSHOT_VERSION;
+    header->kind = kind;
+    header->element_size = (uint32_t)q->buffer_element_size;
+    header->capacity = (uint32_t)q->capacity;
+    header->base_seq = 0U;
+#if QUEUE_CFG_SNAPSHOT
+    header->seq = q->push_seq;
+#else
+    header->seq = 0U;
+#endif
+    header->live = (uint32_t)q->count;
+    header->count = count;
+    header->crc = 0U;
+}
+
+/**
+ * @brief Compute the CRC and write header and payload through the sink.
+ *
+ * @param[in]     s       Checkpoint state.
+ * @param[in,out] header  Header with `crc` = 0; receives the CRC.
+ * @param[out]    written Record size (may be NULL).
+ *
+ * @return QUEUE_OK, or QUEUE_ERROR if the write hook failed.
+ */
+static queue_status_t snap_emit(const queue_snapshot_t *s, queue_snapshot_header_t *header, uint32_t *written)
+{
+    queue_status_t ret_status = QUEUE_OK;
+    snap_payload_t payload;
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise access */
+    const uint8_t *header_bytes = (const uint8_t *)header;
+    uint32_t crc = snap_crc(0xFFFFFFFFU, header_bytes, SNAP_HEADER_SIZE);
+
+    snap_payload(s->queue, header->live - header->count, header->count, &payload);
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        crc = snap_crc(crc, payload.data[i], payload.size[i]);
+    }
+    header->crc = crc ^ 0xFFFFFFFFU;
+
+    if (!s->sink.write(s->sink.ctx, header, SNAP_HEADER_SIZE))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    for (uint32_t i = 0U; (ret_status == QUEUE_OK) && (i < 2U); i++)
+    {
+        if ((payload.size[i] > 0U) && !s->sink.write(s->sink.ctx, payload.data[i], payload.size[i]))
+        {
+            ret_status = QUEUE_ERROR;
+        }
+    }
+    if ((ret_status == QUEUE_OK) && (written != NULL))
+    {
+        *written = SNAP_HEADER_SIZE + payload.size[0] + payload.size[1];
+    }
+
+    return ret_status;
+}
+
+/**
+ * @brief Locate stored elements [from, from + count) counted from head.
+ *
+ * @param[in]  q       Queue instance.
+ * @param[in]  from    Position of the first element (from + count <= q->count).
+ * @param[in]  count   Number of elements.
+ * @param[out] payload Up to two contiguous segments.
+ */
+static void snap_payload(const queue_t *q, uint32_t from, uint32_t count, snap_payload_t *payload)
+{
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise access */
+    const uint8_t *base = (const uint8_t *)q->buffer;
+    const uint32_t capacity = (uint32_t)q->capacity;
+    const uint32_t until_wrap = capacity - (uint32_t)q->head;
+    const uint32_t start = (from < until_wrap) ? ((uint32_t)q->head + from) : (from - until_wrap);
+    const uint32_t first = ((capacity - start) < count) ? (capacity - start) : count;
+    const uint32_t element_size = (uint32_t)q->buffer_element_size;
+
+    payload->data[0] = &base[start * element_size];
+    payload->size[0] = first * element_size;
+    payload->data[1] = base;
+    payload->size[1] = (count - first) * element_size;
+}
+
+/**
+ * @brief Read and check a record header, its geometry and its CRC.
+ *
+ * @param[in]  q      Destination queue.
+ * @param[in]  record Record bytes.
+ * @param[in]  size   Bytes available.
+ * @param[out] header Copy of the header.
+ *
+ * @return QUEUE_OK, QUEUE_EMPTY (no record) or QUEUE_ERROR (damaged or incompatible).
+ */
+static queue_status_t snap_parse(const queue_t *q, const uint8_t *record, uint32_t size,
+                                 queue_snapshot_header_t *header)
+{
+    queue_status_t ret_status = QUEUE_EMPTY;
+
+    if (size >= SNAP_HEADER_SIZE)
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        queue_copy_bytes((uint8_t *)header, record, SNAP_HEADER_SIZE);
+        ret_status = (header->magic == QUEUE_SNAPSHOT_MAGIC) ? QUEUE_OK : QUEUE_EMPTY;
+    }
+    if ((ret_status == QUEUE_OK) &&
+        ((header->version != QUEUE_SNAPSHOT_VERSION) || (header->element_size != (uint32_t)q->buffer_element_size) ||
+         (header->live > (uint32_t)q->capacity) || (header->count > header->live) ||
+         (((uint64_t)header->count * header->element_size) > (uint64_t)(size - SNAP_HEADER_SIZE))))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    if (ret_status == QUEUE_OK)
+    {
+        queue_snapshot_header_t crc_header = *header;
+        uint32_t crc = 0U;
+
+        crc_header.crc = 0U;
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise access */
+        crc = snap_crc(0xFFFFFFFFU, (const uint8_t *)&crc_header, SNAP_HEADER_SIZE);
+        crc = snap_crc(crc, &record[SNAP_HEADER_SIZE], header->count * header->element_size);
+        ret_status = ((crc ^ 0xFFFFFFFFU) == header->crc) ? QUEUE_OK : QUEUE_ERROR;
+    }
+
+    return ret_status;
+}
+
+/**
+ * @brief Check that a record can be applied to the current queue state.
+ *
+ * @param[in] q      Destination queue.
+ * @param[in] header Checked record header.
+ *
+ * @return true for a full record holding every live element, or a delta
+ *         written right after the state the queue is in.
+ */
+static bool snap_continues(const queue_t *q, const queue_snapshot_header_t *header)
+{
+    bool valid = false;
+
+    if (header->kind == QUEUE_SNAPSHOT_FULL)
+    {
+        valid = (header->count == header->live);
+    }
+#if QUEUE_CFG_SNAPSHOT
+    else if (header->kind == QUEUE_SNAPSHOT_DELTA)
+    {
+        valid = (header->base_seq == q->push_seq) && ((header->seq - header->base_seq) >= header->count) &&
+                ((header->live - header->count) <= (uint32_t)q->count);
+    }
+#endif
+    else
+    {
+        (void)q;
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Continue a reflected CRC-32 (polynomial 0xEDB88320) over `data`.
+ *
+ * @param[in] crc  Running CRC (0xFFFFFFFF to start; final value XORed with 0xFFFFFFFF).
+ * @param[in] data Bytes (may be NULL when size is 0).
+ * @param[in] size Number of bytes.
+ *
+ * @return Updated running CRC.
+ *
+ * @details Half-byte table: 64 bytes of constants, two lookups per byte.
+ */
+static uint32_t snap_crc(uint32_t crc, const uint8_t *data, uint32_t size)
+{
+    static const uint32_t table[16] = {0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U,
+                                       0x4DB26158U, 0x5005713CU, 0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+                                       0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU};
+    uint32_t value = crc;
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        value ^= (uint32_t)data[i];
+        value = (value >> 4U) ^ table[value & 0x0FU];
+        value = (value >> 4U) ^ table[value & 0x0FU];
+    }
+
+    return value;
+}
+
+/**
+ * @brief Remember the queue state covered by the record just written.
+ *
+ * @param[in,out] s Checkpoint state.
+ */
+static void snap_mark(queue_snapshot_t *s)
+{
+#if QUEUE_CFG_SNAPSHOT
+    s->seq = s->queue->push_seq;
+    s->rewrites = s->queue->rewrites;
+    s->live = s->queue->count;
+    s->has_base = true;
+#else
+    (void)s;
+#endif
+}
+
+/** @} */ /* end of queue_internal group */
@@ -0,0 +1,194 @@
+/**
+ * @file queue_snapshot.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Snapshot records of the generic queue for persistence across resets.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Serializes the live elements of a `queue_t` into compact records that
+ *  can be appended to flash (or any other backing store) and replayed into
+ *  a queue after a reset.
+ *
+ *  The implementation:
+ *  - writes only the stored elements, oldest first, never the whole buffer,
+ *  - prefixes every record with a header holding element size, capacity,
+ *    element counts, a push sequence number and a CRC-32 of header and
+ *    payload,
+ *  - with @ref QUEUE_CFG_SNAPSHOT enabled, writes delta records holding
+ *    only the elements pushed since the previous checkpoint, so the cost of
+ *    a checkpoint scales with new data instead of capacity,
+ *  - streams records through a user write hook (flash driver) and restores
+ *    them from memory (e.g. memory-mapped flash), checking the CRC and the
+ *    record chain before the queue is touched,
+ *  - avoids dynamic memory allocation and standard library dependencies.
+ *
+ *  Records use the native byte order and are meant to be read back by the
+ *  same firmware.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4) applies to the byte-wise
+ *  record access.
+ *
+ * @note
+ *  A delta record can only describe FIFO pushes and pops. After any other
+ *  change — queue_remove_if() removing elements, queue_push_coalesce()
+ *  replacing the newest element in place — queue_snapshot_delta() writes a
+ *  full record instead (tracked by `queue_t::rewrites`).
+ */
+
+#ifndef QUEUE_SNAPSHOT_H
+#define QUEUE_SNAPSHOT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include "queue_config.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Record magic ("QSNP"). */
+#define QUEUE_SNAPSHOT_MAGIC 0x51534E50U
+
+/** @brief Record format version. */
+#define QUEUE_SNAPSHOT_VERSION 1U
+
+/** @brief Record kind: every live element; replaces the queue contents. */
+#define QUEUE_SNAPSHOT_FULL 0U
+
+/** @brief Record kind: elements pushed since the previous record plus the new element count. */
+#define QUEUE_SNAPSHOT_DELTA 1U
+
+    /**
+     * @ingroup queue
+     * @brief Header at the start of every record, followed by `count` elements.
+     */
+    typedef struct
+    {
+        uint32_t magic;        /**< @ref QUEUE_SNAPSHOT_MAGIC. */
+        uint16_t version;      /**< @ref QUEUE_SNAPSHOT_VERSION. */
+        uint16_t kind;         /**< @ref QUEUE_SNAPSHOT_FULL or @ref QUEUE_SNAPSHOT_DELTA. */
+        uint32_t element_size; /**< Element size in bytes. */
+        uint32_t capacity;     /**< Capacity of the exported queue. */
+        uint32_t base_seq;     /**< Push sequence the record applies to (delta records). */
+        uint32_t seq;          /**< Push sequence after the record. */
+        uint32_t live;         /**< Elements stored in the queue after the record. */
+        uint32_t count;        /**< Elements in the payload (the newest `count` of `live`). */
+        uint32_t crc;          /**< CRC-32 (IEEE 802.3) of the header with `crc` = 0, then the payload. */
+    } queue_snapshot_header_t;
+
+    /**
+     * @ingroup queue
+     * @brief Backing store write hook.
+     *
+     * @param[in] ctx  User context from @ref queue_snapshot_sink_t.
+     * @param[in] data Bytes to append.
+     * @param[in] size Number of bytes.
+     *
+     * @return true if all bytes were written.
+     */
+    typedef bool (*queue_snapshot_write_fn_t)(void *ctx, const void *data, uint32_t size);
+
+    /**
+     * @ingroup queue
+     * @brief Destination of the records.
+     */
+    typedef struct
+    {
+        queue_snapshot_write_fn_t write; /**< Append hook (non-NULL). */
+        void *ctx;                       /**< Passed to `write`. */
+    } queue_snapshot_sink_t;
+
+    /**
+     * @ingroup queue
+     * @brief Checkpoint state of one queue.
+     */
+    typedef struct
+    {
+        const queue_t *queue;       /**< Exported queue. */
+        queue_snapshot_sink_t sink; /**< Record destination. */
+#if QUEUE_CFG_SNAPSHOT
+        uint32_t seq;       /**< `queue->push_seq` at the last checkpoint. */
+        uint32_t rewrites;  /**< `queue->rewrites` at the last checkpoint. */
+        queue_index_t live; /**< `queue->count` at the last checkpoint. */
+        bool has_base;      /**< A record was written since init (deltas allowed). */
+#endif
+    } queue_snapshot_t;
+
+    /**
+     * @ingroup queue
+     * @brief Bind checkpoint state to a queue and a record sink.
+     *
+     * @param[out] s     Checkpoint state.
+     * @param[in]  queue Queue to export.
+     * @param[in]  sink  Record destination (write hook non-NULL).
+     *
+     * @retval QUEUE_OK    Success; the first record will be a full one.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_snapshot_init(queue_snapshot_t *s, const queue_t *queue, const queue_snapshot_sink_t *sink);
+
+    /**
+     * @ingroup queue
+     * @brief Write a full record holding every stored element.
+     *
+     * @param[in,out] s       Checkpoint state.
+     * @param[out]    written Record size in bytes (may be NULL).
+     *
+     * @retval QUEUE_OK    Record written.
+     * @retval QUEUE_ERROR Invalid parameters or the write hook failed.
+     *
+     * @note The queue must not change while the record is written.
+     */
+    queue_status_t queue_snapshot_full(queue_snapshot_t *s, uint32_t *written);
+
+#if QUEUE_CFG_SNAPSHOT
+    /**
+     * @ingroup queue
+     * @brief Write a delta record holding the elements pushed since the last record.
+     *
+     * @param[in,out] s       Checkpoint state.
+     * @param[out]    written Record size in bytes, 0 if nothing changed (may be NULL).
+     *
+     * @retval QUEUE_OK    Record written (a full record if none was written since
+     *                     init or the queue was rewritten out of FIFO order).
+     * @retval QUEUE_EMPTY No push or pop since the last record; nothing written.
+     * @retval QUEUE_ERROR Invalid parameters or the write hook failed.
+     *
+     * @note Elements popped since the last record cost nothing: the record
+     *       only carries the new element count.
+     */
+    queue_status_t queue_snapshot_delta(queue_snapshot_t *s, uint32_t *written);
+#endif
+
+    /**
+     * @ingroup queue
+     * @brief Replay one record into a queue.
+     *
+     * @param[in,out] q      Queue with the same element size and a capacity >= the record's `live`.
+     * @param[in]     record Record bytes (no alignment requirement).
+     * @param[in]     size   Bytes available at `record`.
+     * @param[out]    used   Record size in bytes (may be NULL).
+     *
+     * @retval QUEUE_OK    Record applied; the next record starts `*used` bytes later.
+     * @retval QUEUE_EMPTY No record at `record` (too short or no magic, e.g. erased flash).
+     * @retval QUEUE_ERROR Damaged record (CRC), incompatible geometry, or a
+     *                     delta that does not continue the queue's state; the
+     *                     queue is left unchanged.
+     *
+     * @details A full record replaces the queue contents. A delta record drops
+     *          the oldest elements the exporter popped and appends the new
+     *          ones. Replayed elements count as pushes (and dropped ones as
+     *          pops) in the statistics.
+     */
+    queue_status_t queue_snapshot_restore(queue_t *q, const void *record, uint32_t size, uint32_t *used);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_SNAPSHOT_H */
@@ -0,0 +1,246 @@
+/**
+ * @file queue_soa.c
+ * @brief Struct-of-arrays FIFO queue implementation.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Field `f` of the record in slot `i` lives at
+ *  `fields[f].buffer + i × fields[f].size`. Push copies every field,
+ *  pop/peek only the fields selected by the mask; each field copy goes
+ *  through the shared copy engine, so the usual size/alignment fast paths
+ *  apply per field.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
+ *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_soa.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+static bool soa_fields_valid(const queue_soa_field_t *fields, uint8_t field_count);
+static uint8_t *soa_slot(const queue_soa_field_t *field, uint16_t index);
+static void soa_gather(const queue_soa_t *q, uint8_t *record, uint32_t mask);
+static uint16_t soa_advance(const queue_soa_t *q, uint16_t index);
+
+/* -------------------------- */
+/* Struct-of-arrays queue API */
+/* -------------------------- */
+
+queue_status_t queue_soa_init(queue_soa_t *q, const queue_soa_field_t *fields, uint8_t field_count,
+                              uint16_t capacity)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (capacity == 0U) || !soa_fields_valid(fields, field_count))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        q->fields = fields;
+        q->field_count = field_count;
+        q->capacity = capacity;
+        q->head = 0U;
+        q->tail = 0U;
+        q->count = 0U;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_soa_push(queue_soa_t *q, const void *record)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (record == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count >= q->capacity)
+    {
+        ret_status = QUEUE_FULL;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        const uint8_t *src = (const uint8_t *)record;
+
+        for (uint8_t f = 0U; f < q->field_count; f++)
+        {
+            const queue_soa_field_t *field = &q->fields[f];
+
+            queue_copy_bytes(soa_slot(field, q->tail), &src[field->offset], field->size);
+        }
+        q->tail = soa_advance(q, q->tail);
+        q->count++;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_soa_pop(queue_soa_t *q, void *record, uint32_t mask)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || ((record == NULL) && (mask != 0U)))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        if (mask != 0U)
+        {
+            /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+            soa_gather(q, (uint8_t *)record, mask);
+        }
+        q->head = soa_advance(q, q->head);
+        q->count--;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_soa_peek(const queue_soa_t *q, void *record, uint32_t mask)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (record == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (q->count == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+        soa_gather(q, (uint8_t *)record, mask);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_soa_field_view(const queue_soa_t *q, uint8_t field, queue_soa_view_t *view)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (view == NULL) || (field >= q->field_count))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint16_t until_wrap = (uint16_t)(q->capacity - q->head);
+        const uint16_t first_count = (q->count < until_wrap) ? q->count : until_wrap;
+
+        view->first = soa_slot(&q->fields[field], q->head);
+        view->first_count = first_count;
+        view->second = NULL;
+        view->second_count = (uint16_t)(q->count - first_count);
+        if (view->second_count > 0U)
+        {
+            view->second = q->fields[field].buffer;
+        }
+        if (q->count == 0U)
+        {
+            ret_status = QUEUE_EMPTY;
+        }
+    }
+
+    return ret_status;
+}
+
+bool queue_soa_is_empty(const queue_soa_t *q)
+{
+    return (q == NULL) || (q->count == 0U);
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Validate a field layout.
+ *
+ * @param[in] fields      Field descriptors (may be NULL).
+ * @param[in] field_count Number of descriptors.
+ *
+ * @return true if the count is in range and every field has storage and a size.
+ */
+static bool soa_fields_valid(const queue_soa_field_t *fields, uint8_t field_count)
+{
+    bool valid = (fields != NULL) && (field_count > 0U) && (field_count <= QUEUE_SOA_MAX_FIELDS);
+
+    for (uint8_t f = 0U; valid && (f < field_count); f++)
+    {
+        valid = (fields[f].buffer != NULL) && (fields[f].size > 0U);
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Address of one field value in its sub-buffer.
+ *
+ * @param[in] field Field descriptor.
+ * @param[in] index Slot index (< capacity).
+ *
+ * @return Pointer to the first byte of the value.
+ */
+static uint8_t *soa_slot(const queue_soa_field_t *field, uint16_t index)
+{
+    /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+    uint8_t *base = (uint8_t *)field->buffer;
+
+    return &base[(uint32_t)index * (uint32_t)field->size];
+}
+
+/**
+ * @brief Copy the selected fields of the record at `head` into `record`.
+ *
+ * @param[in]  q      Queue instance (not empty).
+ * @param[out] record Destination record struct.
+ * @param[in]  mask   Field mask.
+ */
+static void soa_gather(const queue_soa_t *q, uint8_t *record, uint32_t mask)
+{
+    for (uint8_t f = 0U; f < q->field_count; f++)
+    {
+        if ((mask & QUEUE_SOA_FIELD(f)) != 0U)
+        {
+            const queue_soa_field_t *field = &q->fields[f];
+
+            queue_copy_bytes(&record[field->offset], soa_slot(field, q->head), field->size);
+        }
+    }
+}
+
+/**
+ * @brief Next slot index with wrap-around.
+ *
+ * @param[in] q     Queue instance.
+ * @param[in] index Current index (< capacity).
+ *
+ * @return (index + 1) mod capacity.
+ */
+static uint16_t soa_advance(const queue_soa_t *q, uint16_t index)
+{
+    const uint32_t next = (uint32_t)index + 1U;
+
+    return (next == (uint32_t)q->capacity) ? 0U : (uint16_t)next;
+}
+
+/** @} */ /* end of queue_internal group */
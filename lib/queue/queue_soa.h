@@ -0,0 +1,177 @@
+/**
+ * @file queue_soa.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Struct-of-arrays FIFO queue with per-field ring sub-buffers.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Variant of the generic FIFO queue for wide records whose consumers read
+ *  only some fields. A field layout descriptor given at init maps each
+ *  record field (offset and size inside the record struct) to its own
+ *  contiguous ring buffer; all fields share one head/tail/count.
+ *
+ *  The implementation:
+ *  - scatters a whole record on push and gathers only the fields selected
+ *    by a bit mask on pop/peek, so memory traffic scales with the selected
+ *    fields, not with the record size,
+ *  - exposes every field as at most two contiguous arrays
+ *    (queue_soa_field_view()) for sequential or SIMD scans of one field
+ *    across all queued elements,
+ *  - supports up to @ref QUEUE_SOA_MAX_FIELDS fields,
+ *  - avoids dynamic memory allocation and standard library dependencies.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4) applies to the field copies.
+ */
+
+#ifndef QUEUE_SOA_H
+#define QUEUE_SOA_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Maximum number of fields (width of the field mask). */
+#define QUEUE_SOA_MAX_FIELDS 32U
+
+/** @brief Field mask selecting every field. */
+#define QUEUE_SOA_ALL_FIELDS 0xFFFFFFFFU
+
+/** @brief Field mask bit of field `i`. */
+#define QUEUE_SOA_FIELD(i) ((uint32_t)1U << (i))
+
+    /**
+     * @ingroup queue
+     * @brief Layout of one record field and its ring sub-buffer.
+     */
+    typedef struct
+    {
+        void *buffer;    /**< Field storage (size × capacity bytes). */
+        uint16_t offset; /**< Offset of the field inside the record struct (e.g. offsetof()). */
+        uint16_t size;   /**< Field size in bytes (> 0). */
+    } queue_soa_field_t;
+
+    /**
+     * @ingroup queue
+     * @brief Struct-of-arrays queue control structure.
+     */
+    typedef struct
+    {
+        const queue_soa_field_t *fields; /**< Caller-supplied field layout. */
+        uint8_t field_count;             /**< Number of fields (1..QUEUE_SOA_MAX_FIELDS). */
+        uint16_t capacity;               /**< Maximum number of records (> 0). */
+        uint16_t head;                   /**< Read index. */
+        uint16_t tail;                   /**< Write index. */
+        uint16_t count;                  /**< Current number of stored records. */
+    } queue_soa_t;
+
+    /**
+     * @ingroup queue
+     * @brief One field of all stored records, oldest first, as up to two arrays.
+     */
+    typedef struct
+    {
+        const void *first;     /**< Field values from `head` up to the wrap point. */
+        uint16_t first_count;  /**< Number of values in `first`. */
+        const void *second;    /**< Field values after the wrap point (NULL if none). */
+        uint16_t second_count; /**< Number of values in `second`. */
+    } queue_soa_view_t;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize a struct-of-arrays queue.
+     *
+     * @param[in,out] q           Pointer to queue control structure.
+     * @param[in]     fields      Array of `field_count` field descriptors
+     *                            (each with non-NULL buffer and size > 0).
+     * @param[in]     field_count Number of fields (1..QUEUE_SOA_MAX_FIELDS).
+     * @param[in]     capacity    Number of records in queue (must > 0).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments.
+     *
+     * @note The field array must stay valid for the lifetime of the queue.
+     */
+    queue_status_t queue_soa_init(queue_soa_t *q, const queue_soa_field_t *fields, uint8_t field_count,
+                                  uint16_t capacity);
+
+    /**
+     * @ingroup queue
+     * @brief Push one record, scattering its fields into their sub-buffers.
+     *
+     * @param[in,out] q      Pointer to queue instance.
+     * @param[in]     record Pointer to the record struct.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_FULL  Queue full — record not added.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_soa_push(queue_soa_t *q, const void *record);
+
+    /**
+     * @ingroup queue
+     * @brief Pop the oldest record, copying only the selected fields.
+     *
+     * @param[in,out] q      Pointer to queue instance.
+     * @param[out]    record Record struct receiving the selected fields (may
+     *                       be NULL when `mask` is 0 — the record is dropped).
+     * @param[in]     mask   Field mask (QUEUE_SOA_FIELD(i) bits, or QUEUE_SOA_ALL_FIELDS).
+     *
+     * @retval QUEUE_OK    Success; unselected fields of `record` are untouched.
+     * @retval QUEUE_EMPTY Queue empty — nothing copied.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_soa_pop(queue_soa_t *q, void *record, uint32_t mask);
+
+    /**
+     * @ingroup queue
+     * @brief Copy the selected fields of the oldest record without removing it.
+     *
+     * @param[in]  q      Pointer to queue instance.
+     * @param[out] record Record struct receiving the selected fields.
+     * @param[in]  mask   Field mask.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_EMPTY Queue empty — nothing copied.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_soa_peek(const queue_soa_t *q, void *record, uint32_t mask);
+
+    /**
+     * @ingroup queue
+     * @brief Describe one field of all stored records for an in-place scan.
+     *
+     * @param[in]  q     Pointer to queue instance.
+     * @param[in]  field Field index.
+     * @param[out] view  Up to two contiguous arrays of `fields[field].size`-byte values.
+     *
+     * @retval QUEUE_OK    `view` filled.
+     * @retval QUEUE_EMPTY Queue empty — `view` holds two empty arrays.
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Zero-copy; valid until the next pop.
+     */
+    queue_status_t queue_soa_field_view(const queue_soa_t *q, uint8_t field, queue_soa_view_t *view);
+
+    /**
+     * @ingroup queue
+     * @brief Check if struct-of-arrays queue is empty.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue empty or q is NULL.
+     * @return false — otherwise.
+     */
+    bool queue_soa_is_empty(const queue_soa_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_SOA_H */
@@ -0,0 +1,399 @@
+/**
+ * @file queue_spsc.c
+ * @brief Lock-free single-producer / single-consumer FIFO queue implementation.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  The producer owns `tail`, the consumer owns `head`. Each side reads the
+ *  other side's index with acquire semantics and publishes its own index
+ *  with release semantics after the element copy, so no interrupt masking
+ *  or mutex is needed. The other side's index is read only when the private
+ *  cached copy says the queue is full (push) or empty (peek/pop), which keeps
+ *  the other side's cache line out of the fast path.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4)
+ *  Controlled cast from `void*` to `uint8_t*` for raw byte access.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_spsc.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+#if QUEUE_CFG_USE_C11_ATOMICS
+#define SPSC_LOAD_RELAXED(p)     atomic_load_explicit((p), memory_order_relaxed)
+#define SPSC_LOAD_ACQUIRE(p)     atomic_load_explicit((p), memory_order_acquire)
+#define SPSC_STORE_RELEASE(p, v) atomic_store_explicit((p), (v), memory_order_release)
+#else
+#define SPSC_LOAD_RELAXED(p) (*(p))
+#define SPSC_LOAD_ACQUIRE(p) spsc_load_acquire(p)
+#define SPSC_STORE_RELEASE(p, v) \
+    do                           \
+    {                            \
+        QUEUE_SPSC_BARRIER();    \
+        *(p) = (v);              \
+    } while (0)
+
+static uint32_t spsc_load_acquire(const queue_spsc_index_t *p)
+{
+    const uint32_t value = *p;
+
+    QUEUE_SPSC_BARRIER();
+
+    return value;
+}
+#endif
+
+/**
+ * @brief Run of `n` consecutive slots as up to two contiguous byte ranges.
+ */
+typedef struct
+{
+    uint32_t offset;       /**< Byte offset of the first slot. */
+    uint32_t first_bytes;  /**< Bytes from `offset` up to the wrap point. */
+    uint32_t second_bytes; /**< Bytes continuing at offset 0. */
+} spsc_run_t;
+
+static uint32_t spsc_used(const queue_spsc_t *q, uint32_t head, uint32_t tail);
+static uint32_t spsc_next(const queue_spsc_t *q, uint32_t index);
+static uint32_t spsc_slot(const queue_spsc_t *q, uint32_t index);
+static uint32_t spsc_slot_offset(const queue_spsc_t *q, uint32_t index);
+static uint32_t spsc_advance(const queue_spsc_t *q, uint32_t index, uint32_t n);
+static void spsc_run(const queue_spsc_t *q, uint32_t index, uint32_t n, spsc_run_t *run);
+
+/* -------------------------- */
+/* SPSC API implementation    */
+/* -------------------------- */
+
+queue_status_t queue_spsc_init(queue_spsc_t *q, void *buffer, uint16_t buffer_element_size, uint16_t queue_capacity)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (buffer == NULL) || (buffer_element_size == 0U) || (queue_capacity == 0U))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        q->buffer = buffer;
+        q->buffer_element_size = buffer_element_size;
+        q->capacity = queue_capacity;
+        q->tail_cache = 0U;
+        q->head_cache = 0U;
+        SPSC_STORE_RELEASE(&q->head, 0U);
+        SPSC_STORE_RELEASE(&q->tail, 0U);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_spsc_push(queue_spsc_t *q, const void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint32_t tail = SPSC_LOAD_RELAXED(&q->tail);
+
+        if (spsc_used(q, q->head_cache, tail) >= (uint32_t)q->capacity)
+        {
+            /* looks full: refresh the consumer's index from its cache line */
+            q->head_cache = SPSC_LOAD_ACQUIRE(&q->head);
+        }
+
+        if (spsc_used(q, q->head_cache, tail) >= (uint32_t)q->capacity)
+        {
+            ret_status = QUEUE_FULL;
+        }
+        else
+        {
+            /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+            uint8_t *base = (uint8_t *)q->buffer;
+
+            queue_copy_bytes(&base[spsc_slot_offset(q, tail)], (const uint8_t *)item, q->buffer_element_size);
+            SPSC_STORE_RELEASE(&q->tail, spsc_next(q, tail));
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_spsc_pop(queue_spsc_t *q, void *item)
+{
+    queue_status_t ret_status = queue_spsc_peek(q, item);
+
+    if (ret_status == QUEUE_OK)
+    {
+        const uint32_t head = SPSC_LOAD_RELAXED(&q->head);
+
+        SPSC_STORE_RELEASE(&q->head, spsc_next(q, head));
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_spsc_peek(queue_spsc_t *q, void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint32_t head = SPSC_LOAD_RELAXED(&q->head);
+
+        if (head == q->tail_cache)
+        {
+            /* looks empty: refresh the producer's index from its cache line */
+            q->tail_cache = SPSC_LOAD_ACQUIRE(&q->tail);
+        }
+
+        if (head == q->tail_cache)
+        {
+            ret_status = QUEUE_EMPTY;
+        }
+        else
+        {
+            /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+            const uint8_t *base = (const uint8_t *)q->buffer;
+
+            queue_copy_bytes((uint8_t *)item, &base[spsc_slot_offset(q, head)], q->buffer_element_size);
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_spsc_push_all(queue_spsc_t *q, const void *items, uint16_t n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (items == NULL) || (n > q->capacity))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint32_t tail = SPSC_LOAD_RELAXED(&q->tail);
+
+        if (((uint32_t)q->capacity - spsc_used(q, q->head_cache, tail)) < (uint32_t)n)
+        {
+            q->head_cache = SPSC_LOAD_ACQUIRE(&q->head);
+        }
+        if (((uint32_t)q->capacity - spsc_used(q, q->head_cache, tail)) < (uint32_t)n)
+        {
+            ret_status = QUEUE_FULL;
+        }
+        else
+        {
+            /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+            uint8_t *base = (uint8_t *)q->buffer;
+            const uint8_t *src = (const uint8_t *)items;
+            spsc_run_t run;
+
+            spsc_run(q, tail, n, &run);
+            queue_copy_bytes(&base[run.offset], src, run.first_bytes);
+            queue_copy_bytes(base, &src[run.first_bytes], run.second_bytes);
+            SPSC_STORE_RELEASE(&q->tail, spsc_advance(q, tail, n));
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_spsc_pop_exact(queue_spsc_t *q, void *items, uint16_t n)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((q == NULL) || (items == NULL) || (n > q->capacity))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint32_t head = SPSC_LOAD_RELAXED(&q->head);
+
+        if (spsc_used(q, head, q->tail_cache) < (uint32_t)n)
+        {
+            q->tail_cache = SPSC_LOAD_ACQUIRE(&q->tail);
+        }
+        if (spsc_used(q, head, q->tail_cache) < (uint32_t)n)
+        {
+            ret_status = QUEUE_EMPTY;
+        }
+        else
+        {
+            /* MISRA Deviation DV-QUEUE-001: controlled cast for byte-wise copy */
+            const uint8_t *base = (const uint8_t *)q->buffer;
+            uint8_t *dst = (uint8_t *)items;
+            spsc_run_t run;
+
+            spsc_run(q, head, n, &run);
+            queue_copy_bytes(dst, &base[run.offset], run.first_bytes);
+            queue_copy_bytes(&dst[run.first_bytes], base, run.second_bytes);
+            SPSC_STORE_RELEASE(&q->head, spsc_advance(q, head, n));
+        }
+    }
+
+    return ret_status;
+}
+
+bool queue_spsc_is_empty(queue_spsc_t *q)
+{
+    bool is_empty = true;
+
+    if (q != NULL)
+    {
+        is_empty = (SPSC_LOAD_ACQUIRE(&q->head) == SPSC_LOAD_ACQUIRE(&q->tail));
+    }
+
+    return is_empty;
+}
+
+bool queue_spsc_is_full(queue_spsc_t *q)
+{
+    bool is_full = false;
+
+    if (q != NULL)
+    {
+        const uint32_t head = SPSC_LOAD_ACQUIRE(&q->head);
+        const uint32_t tail = SPSC_LOAD_ACQUIRE(&q->tail);
+
+        is_full = (spsc_used(q, head, tail) == (uint32_t)q->capacity);
+    }
+
+    return is_full;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Number of stored elements for a head/tail snapshot.
+ *
+ * @param[in] q    Queue instance.
+ * @param[in] head Read index in [0, 2 × capacity).
+ * @param[in] tail Write index in [0, 2 × capacity).
+ *
+ * @return Number of elements between head and tail (0..capacity).
+ */
+static uint32_t spsc_used(const queue_spsc_t *q, uint32_t head, uint32_t tail)
+{
+    uint32_t used = tail - head;
+
+    if (tail < head)
+    {
+        used += 2U * (uint32_t)q->capacity;
+    }
+
+    return used;
+}
+
+/**
+ * @brief Advance an index by one inside [0, 2 × capacity).
+ *
+ * @param[in] q     Queue instance.
+ * @param[in] index Current index.
+ *
+ * @return Next index.
+ */
+static uint32_t spsc_next(const queue_spsc_t *q, uint32_t index)
+{
+    uint32_t next = index + 1U;
+
+    if (next == (2U * (uint32_t)q->capacity))
+    {
+        next = 0U;
+    }
+
+    return next;
+}
+
+/**
+ * @brief Element slot addressed by an index.
+ *
+ * @param[in] q     Queue instance.
+ * @param[in] index Index in [0, 2 × capacity).
+ *
+ * @return Slot number in [0, capacity).
+ */
+static uint32_t spsc_slot(const queue_spsc_t *q, uint32_t index)
+{
+    uint32_t slot = index;
+
+    if (slot >= (uint32_t)q->capacity)
+    {
+        slot -= (uint32_t)q->capacity;
+    }
+
+    return slot;
+}
+
+/**
+ * @brief Byte offset of the element slot addressed by an index.
+ *
+ * @param[in] q     Queue instance.
+ * @param[in] index Index in [0, 2 × capacity).
+ *
+ * @return Byte offset of the slot inside `buffer`.
+ */
+static uint32_t spsc_slot_offset(const queue_spsc_t *q, uint32_t index)
+{
+    return spsc_slot(q, index) * (uint32_t)q->buffer_element_size;
+}
+
+/**
+ * @brief Advance an index by `n` inside [0, 2 × capacity).
+ *
+ * @param[in] q     Queue instance.
+ * @param[in] index Current index.
+ * @param[in] n     Step (<= capacity).
+ *
+ * @return (index + n) mod 2 × capacity.
+ */
+static uint32_t spsc_advance(const queue_spsc_t *q, uint32_t index, uint32_t n)
+{
+    uint32_t next = index + n;
+
+    if (next >= (2U * (uint32_t)q->capacity))
+    {
+        next -= 2U * (uint32_t)q->capacity;
+    }
+
+    return next;
+}
+
+/**
+ * @brief Split the slots [index, index + n) at the wrap point.
+ *
+ * @param[in]  q     Queue instance.
+ * @param[in]  index First index in [0, 2 × capacity).
+ * @param[in]  n     Number of slots (<= capacity).
+ * @param[out] run   Byte ranges of the slots.
+ */
+static void spsc_run(const queue_spsc_t *q, uint32_t index, uint32_t n, spsc_run_t *run)
+{
+    const uint32_t element_size = (uint32_t)q->buffer_element_size;
+    const uint32_t slot = spsc_slot(q, index);
+    const uint32_t until_wrap = (uint32_t)q->capacity - slot;
+    const uint32_t first = (n < until_wrap) ? n : until_wrap;
+
+    run->offset = slot * element_size;
+    run->first_bytes = first * element_size;
+    run->second_bytes = (n - first) * element_size;
+}
+
+/** @} */ /* end of queue_internal group */
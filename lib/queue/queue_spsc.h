@@ -0,0 +1,199 @@
+/**
+ * @file queue_spsc.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Lock-free single-producer / single-consumer FIFO queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Variant of the generic FIFO queue for handing data from one producer
+ *  context to one consumer context (ISR → task, core → core) without a
+ *  critical section.
+ *
+ *  The implementation:
+ *  - has no shared `count` field — the producer only writes `tail`,
+ *    the consumer only writes `head`,
+ *  - publishes indices with release stores and reads the other side's
+ *    index with acquire loads (C11 atomics or @ref QUEUE_SPSC_BARRIER),
+ *  - keeps indices in the range [0, 2 × capacity), so the full capacity is
+ *    usable and no division is needed,
+ *  - avoids dynamic memory allocation and standard library dependencies.
+ *
+ *  MISRA Deviation: DV-QUEUE-001 (Rule 11.4) applies to the element copy.
+ *
+ * @note
+ *  Exactly one context may call the producer functions (queue_spsc_push())
+ *  and exactly one context the consumer functions (queue_spsc_pop(),
+ *  queue_spsc_peek()). queue_spsc_init() must complete before either side runs.
+ */
+
+#ifndef QUEUE_SPSC_H
+#define QUEUE_SPSC_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include "queue_config.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#if QUEUE_CFG_USE_C11_ATOMICS
+#include <stdatomic.h>
+    /** @brief Index shared between producer and consumer. */
+    typedef _Atomic uint32_t queue_spsc_index_t;
+#else
+    /** @brief Index shared between producer and consumer. */
+    typedef volatile uint32_t queue_spsc_index_t;
+#endif
+
+    /**
+     * @ingroup queue
+     * @brief SPSC queue control structure.
+     *
+     * @details
+     *  `head` is written only by the consumer, `tail` only by the producer.
+     *  Both run over [0, 2 × capacity); the element slot is the index modulo
+     *  capacity, computed with a single conditional subtraction.
+     *
+     *  Each side keeps a private copy of the other side's index and reloads the
+     *  shared one only when the queue looks full (producer) or empty (consumer).
+     *  With @ref QUEUE_CFG_CACHE_LINE_ALIGN the consumer and producer groups
+     *  start on separate cache lines.
+     */
+    typedef struct
+    {
+        void *buffer;                                /**< Pointer to user-provided data buffer. */
+        uint16_t buffer_element_size;                /**< Element size in bytes (> 0). */
+        uint16_t capacity;                           /**< Maximum number of elements (> 0). */
+        QUEUE_CACHE_ALIGNED queue_spsc_index_t head; /**< Read index (consumer-owned). */
+        uint32_t tail_cache;                         /**< Consumer's last seen `tail`. */
+        QUEUE_CACHE_ALIGNED queue_spsc_index_t tail; /**< Write index (producer-owned). */
+        uint32_t head_cache;                         /**< Producer's last seen `head`. */
+    } queue_spsc_t;
+
+    /**
+     * @ingroup queue
+     * @brief Initialize an SPSC queue instance.
+     *
+     * @param[in,out] q            Pointer to queue control structure.
+     * @param[in]     buffer       Pointer to caller-supplied storage buffer.
+     * @param[in]     buffer_element_size Element size in bytes (must > 0).
+     * @param[in]     queue_capacity Number of elements in queue (must > 0).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments (NULL or 0).
+     *
+     * @note Not thread-safe; call before producer and consumer start.
+     */
+    queue_status_t queue_spsc_init(queue_spsc_t *q, void *buffer, uint16_t buffer_element_size, uint16_t queue_capacity);
+
+    /**
+     * @ingroup queue
+     * @brief Push one element (producer side only).
+     *
+     * @param[in,out] q    Pointer to queue instance.
+     * @param[in]     item Pointer to element data to add.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_FULL  Queue already full.
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic; lock-free and wait-free.
+     */
+    queue_status_t queue_spsc_push(queue_spsc_t *q, const void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Pop one element (consumer side only).
+     *
+     * @param[in,out] q    Pointer to queue instance.
+     * @param[out]    item Pointer to destination buffer to store element.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_EMPTY Queue empty — no element available (item unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note Deterministic; lock-free and wait-free.
+     */
+    queue_status_t queue_spsc_pop(queue_spsc_t *q, void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Peek at the oldest element without removing it (consumer side only).
+     *
+     * @param[in]  q    Pointer to queue instance.
+     * @param[out] item Pointer to destination buffer to store the element.
+     *
+     * @retval QUEUE_OK    Success, first element copied to `item`.
+     * @retval QUEUE_EMPTY Queue is empty — no element available (item unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_spsc_peek(queue_spsc_t *q, void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Push exactly `n` elements or none (producer side only).
+     *
+     * @param[in,out] q     Pointer to queue instance.
+     * @param[in]     items Pointer to an array of `n` elements.
+     * @param[in]     n     Number of elements (<= capacity).
+     *
+     * @retval QUEUE_OK    All `n` elements added.
+     * @retval QUEUE_FULL  Fewer than `n` free slots — nothing added.
+     * @retval QUEUE_ERROR Invalid parameters or `n` > capacity.
+     *
+     * @note Lock-free and wait-free. `tail` is published once after all
+     *       copies, so the consumer sees the whole frame or none of it.
+     */
+    queue_status_t queue_spsc_push_all(queue_spsc_t *q, const void *items, uint16_t n);
+
+    /**
+     * @ingroup queue
+     * @brief Pop exactly `n` elements or none (consumer side only).
+     *
+     * @param[in,out] q     Pointer to queue instance.
+     * @param[out]    items Destination array of `n` elements.
+     * @param[in]     n     Number of elements (<= capacity).
+     *
+     * @retval QUEUE_OK    All `n` elements removed.
+     * @retval QUEUE_EMPTY Fewer than `n` elements stored — nothing removed.
+     * @retval QUEUE_ERROR Invalid parameters or `n` > capacity.
+     *
+     * @note Lock-free and wait-free. `head` is published once.
+     */
+    queue_status_t queue_spsc_pop_exact(queue_spsc_t *q, void *items, uint16_t n);
+
+    /**
+     * @ingroup queue
+     * @brief Check if SPSC queue is empty.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue empty or q is NULL.
+     * @return false — otherwise.
+     *
+     * @note The result is a snapshot; it may change as soon as the other side runs.
+     */
+    bool queue_spsc_is_empty(queue_spsc_t *q);
+
+    /**
+     * @ingroup queue
+     * @brief Check if SPSC queue is full.
+     *
+     * @param[in] q Pointer to queue instance.
+     * @return true  — queue full.
+     * @return false — otherwise (including q is NULL).
+     *
+     * @note The result is a snapshot; it may change as soon as the other side runs.
+     */
+    bool queue_spsc_is_full(queue_spsc_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_SPSC_H */
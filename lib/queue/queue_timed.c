@@ -0,0 +1,142 @@
+/**
+ * @file queue_timed.c
+ * @brief Push timestamps and expiry drop on top of the generic queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  `stamps[i]` holds the push time of the element in slot `i`. Elements
+ *  leave in push order, so the expired ones always form a run starting at
+ *  `head`; the run is counted on the stamp array and discarded with a
+ *  single queue_read_advance().
+ *
+ * @ingroup queue
+ */
+
+#include "queue_timed.h"
+#include <stddef.h> /* for NULL */
+
+static queue_index_t timed_count_expired(const queue_timed_t *t, uint32_t now, uint32_t max_age);
+
+/* -------------------------- */
+/* Timestamped queue API      */
+/* -------------------------- */
+
+queue_status_t queue_timed_init(queue_timed_t *t, queue_t *queue, const queue_timed_config_t *cfg)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((t == NULL) || (queue == NULL) || (cfg == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if ((cfg->stamps == NULL) || (cfg->now == NULL) || !queue_is_empty(queue))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        t->queue = queue;
+        t->cfg = *cfg;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_timed_push(queue_timed_t *t, const void *item)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (t == NULL)
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        /* `tail` before the push is the slot queue_push() fills */
+        const queue_index_t slot = t->queue->tail;
+        const uint32_t now = t->cfg.now(t->cfg.clock_ctx);
+
+        ret_status = queue_push(t->queue, item);
+        if (ret_status == QUEUE_OK)
+        {
+            t->cfg.stamps[slot] = now;
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_timed_pop_fresh(queue_timed_t *t, void *item, uint32_t max_age, queue_timed_info_t *info)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((t == NULL) || (item == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        const uint32_t now = t->cfg.now(t->cfg.clock_ctx);
+        queue_timed_info_t result;
+
+        result.dropped = timed_count_expired(t, now, max_age);
+        result.latency = 0U;
+        (void)queue_read_advance(t->queue, result.dropped);
+
+        if (queue_is_empty(t->queue))
+        {
+            ret_status = QUEUE_EMPTY;
+        }
+        else
+        {
+            result.latency = now - t->cfg.stamps[t->queue->head];
+            ret_status = queue_pop(t->queue, item);
+        }
+
+        if (info != NULL)
+        {
+            *info = result;
+        }
+    }
+
+    return ret_status;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Length of the run of expired elements starting at `head`.
+ *
+ * @param[in] t       Timestamped queue.
+ * @param[in] now     Current clock value.
+ * @param[in] max_age Largest accepted age in ticks.
+ *
+ * @return Number of leading elements older than `max_age` (<= count).
+ */
+static queue_index_t timed_count_expired(const queue_timed_t *t, uint32_t now, uint32_t max_age)
+{
+    const queue_t *q = t->queue;
+    uint32_t index = (uint32_t)q->head;
+    uint32_t expired = 0U;
+
+    while ((expired < (uint32_t)q->count) && ((now - t->cfg.stamps[index]) > max_age))
+    {
+        expired++;
+        index++;
+        if (index == (uint32_t)q->capacity)
+        {
+            index = 0U;
+        }
+    }
+
+    return (queue_index_t)expired;
+}
+
+/** @} */ /* end of queue_internal group */
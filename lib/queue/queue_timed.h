@@ -0,0 +1,123 @@
+/**
+ * @file queue_timed.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Optional push timestamps and expiry drop on top of the generic queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  For control messages that are worthless once stale: every push records
+ *  the time of a user clock hook in a per-slot stamp array, and
+ *  queue_timed_pop_fresh() discards expired elements at `head` before
+ *  handing out the first fresh one.
+ *
+ *  The implementation:
+ *  - keeps one 32-bit stamp per slot in a caller-supplied array indexed
+ *    like the queue buffer, so the element layout is unchanged,
+ *  - drops expired elements by advancing `head` only — their data is
+ *    never copied,
+ *  - reports the number of dropped elements and the queueing latency of
+ *    the returned element (suitable for latency instrumentation),
+ *  - compares ages as wrapped differences, so any free-running tick counter
+ *    can be used as the clock,
+ *  - avoids dynamic memory allocation and standard library dependencies.
+ *
+ * @note
+ *  All pushes and pops of an attached queue must go through this layer,
+ *  otherwise stamps and elements get out of step.
+ */
+
+#ifndef QUEUE_TIMED_H
+#define QUEUE_TIMED_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+    /**
+     * @ingroup queue
+     * @brief Configuration of a timestamped queue.
+     */
+    typedef struct
+    {
+        uint32_t *stamps;     /**< Stamp array (capacity entries of the attached queue). */
+        queue_clock_fn_t now; /**< Clock hook (non-NULL). */
+        void *clock_ctx;      /**< Argument passed to `now`. */
+    } queue_timed_config_t;
+
+    /**
+     * @ingroup queue
+     * @brief Timestamped queue control structure.
+     */
+    typedef struct
+    {
+        queue_t *queue;           /**< Underlying queue. */
+        queue_timed_config_t cfg; /**< Stamp array and clock hook. */
+    } queue_timed_t;
+
+    /**
+     * @ingroup queue
+     * @brief Result details of queue_timed_pop_fresh().
+     */
+    typedef struct
+    {
+        queue_index_t dropped; /**< Expired elements discarded by this call. */
+        uint32_t latency;      /**< Ticks the returned element spent in the queue. */
+    } queue_timed_info_t;
+
+    /**
+     * @ingroup queue
+     * @brief Attach the timestamp layer to an initialized, empty queue.
+     *
+     * @param[out] t     Pointer to timestamped queue structure.
+     * @param[in]  queue Pointer to an initialized queue_t.
+     * @param[in]  cfg   Stamp array and clock hook (copied).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments (NULL, or queue not empty).
+     */
+    queue_status_t queue_timed_init(queue_timed_t *t, queue_t *queue, const queue_timed_config_t *cfg);
+
+    /**
+     * @ingroup queue
+     * @brief Push one element stamped with the current clock value.
+     *
+     * @param[in,out] t    Pointer to timestamped queue.
+     * @param[in]     item Pointer to element data to add.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_FULL  Queue full — element not added.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_timed_push(queue_timed_t *t, const void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Drop expired elements, then pop the oldest fresh one.
+     *
+     * @param[in,out] t       Pointer to timestamped queue.
+     * @param[out]    item    Pointer to destination buffer to store element.
+     * @param[in]     max_age Largest accepted age in ticks; older elements are
+     *                        discarded (0xFFFFFFFF — never discard).
+     * @param[out]    info    Optional (may be NULL): dropped count and latency.
+     *
+     * @retval QUEUE_OK    Fresh element copied to `item` and removed.
+     * @retval QUEUE_EMPTY No fresh element left (item unchanged, expired ones dropped).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note One clock read; O(dropped) stamp reads, no copy of dropped elements.
+     */
+    queue_status_t queue_timed_pop_fresh(queue_timed_t *t, void *item, uint32_t max_age, queue_timed_info_t *info);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_TIMED_H */
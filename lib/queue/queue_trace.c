@@ -0,0 +1,263 @@
+/**
+ * @file queue_trace.c
+ * @brief Latency histogram tracing layer for the generic queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  A call costing `d` ticks after overhead compensation lands in bucket
+ *  `32 − clz(d)` (bucket 0 for d = 0), i.e. bucket `b` holds
+ *  [2^(b−1), 2^b). The overhead is the smallest duration of a few
+ *  back-to-back clock read pairs sampled at init.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_trace.h"
+#include "queue_internal.h"
+#include <stddef.h> /* for NULL */
+
+/** @brief Clock read pairs sampled to measure the overhead. */
+#define TRACE_CALIBRATION_ROUNDS 4U
+
+static void trace_clear(queue_trace_t *t);
+static uint32_t trace_overhead(const queue_trace_config_t *cfg);
+static void trace_record(queue_trace_t *t, queue_trace_op_t op, uint32_t start);
+static uint32_t trace_saturating_inc(uint32_t value);
+
+/* -------------------------- */
+/* Tracing layer API          */
+/* -------------------------- */
+
+queue_status_t queue_trace_init(queue_trace_t *t, queue_t *queue, const queue_trace_config_t *cfg)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((t == NULL) || (queue == NULL) || (cfg == NULL) || (cfg->now == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        t->queue = queue;
+        t->cfg = *cfg;
+        t->overhead = trace_overhead(cfg);
+        trace_clear(t);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_trace_push(queue_trace_t *t, const void *item)
+{
+    queue_status_t ret_status = QUEUE_ERROR;
+
+    if (t != NULL)
+    {
+        const uint32_t start = t->cfg.now(t->cfg.clock_ctx);
+
+        ret_status = queue_push(t->queue, item);
+        trace_record(t, QUEUE_TRACE_PUSH, start);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_trace_pop(queue_trace_t *t, void *item)
+{
+    queue_status_t ret_status = QUEUE_ERROR;
+
+    if (t != NULL)
+    {
+        const uint32_t start = t->cfg.now(t->cfg.clock_ctx);
+
+        ret_status = queue_pop(t->queue, item);
+        trace_record(t, QUEUE_TRACE_POP, start);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_trace_peek(queue_trace_t *t, void *item)
+{
+    queue_status_t ret_status = QUEUE_ERROR;
+
+    if (t != NULL)
+    {
+        const uint32_t start = t->cfg.now(t->cfg.clock_ctx);
+
+        ret_status = queue_peek(t->queue, item);
+        trace_record(t, QUEUE_TRACE_PEEK, start);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_trace_reset(queue_trace_t *t)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if (t == NULL)
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        trace_clear(t);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_trace_dump(const queue_trace_t *t, queue_trace_dump_fn_t fn, void *ctx)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((t == NULL) || (fn == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        fn(ctx, QUEUE_TRACE_PUSH, &t->hist[QUEUE_TRACE_PUSH]);
+        fn(ctx, QUEUE_TRACE_POP, &t->hist[QUEUE_TRACE_POP]);
+        fn(ctx, QUEUE_TRACE_PEEK, &t->hist[QUEUE_TRACE_PEEK]);
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_trace_quantile(const queue_trace_hist_t *hist, uint32_t permille, uint32_t *ticks)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((hist == NULL) || (ticks == NULL) || (permille > 1000U))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (hist->samples == 0U)
+    {
+        ret_status = QUEUE_EMPTY;
+    }
+    else
+    {
+        /* smallest sample rank covering the share, at least the first sample */
+        const uint64_t needed = (((uint64_t)hist->samples * permille) + 999U) / 1000U;
+        uint64_t seen = 0U;
+        uint32_t b = 0U;
+
+        while ((b < (QUEUE_TRACE_BUCKETS - 1U)) &&
+               (((seen + hist->buckets[b]) < needed) || ((seen + hist->buckets[b]) == 0U)))
+        {
+            seen += hist->buckets[b];
+            b++;
+        }
+        *ticks = (b < 32U) ? ((uint32_t)1U << b) : UINT32_MAX;
+        if ((hist->max < UINT32_MAX) && (*ticks > (hist->max + 1U)))
+        {
+            *ticks = hist->max + 1U;
+        }
+    }
+
+    return ret_status;
+}
+
+const char *queue_trace_op_name(queue_trace_op_t op)
+{
+    static const char *const names[QUEUE_TRACE_OPS] = {"push", "pop", "peek"};
+    const char *name = "?";
+
+    if ((uint32_t)op < (uint32_t)QUEUE_TRACE_OPS)
+    {
+        name = names[op];
+    }
+
+    return name;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Zero every histogram.
+ *
+ * @param[in,out] t Traced queue.
+ */
+static void trace_clear(queue_trace_t *t)
+{
+    for (uint32_t op = 0U; op < (uint32_t)QUEUE_TRACE_OPS; op++)
+    {
+        queue_trace_hist_t *hist = &t->hist[op];
+
+        for (uint32_t b = 0U; b < QUEUE_TRACE_BUCKETS; b++)
+        {
+            hist->buckets[b] = 0U;
+        }
+        hist->samples = 0U;
+        hist->min = UINT32_MAX;
+        hist->max = 0U;
+    }
+}
+
+/**
+ * @brief Measure the cost of one clock read pair.
+ *
+ * @param[in] cfg Clock hook.
+ *
+ * @return Smallest difference of TRACE_CALIBRATION_ROUNDS back-to-back reads.
+ */
+static uint32_t trace_overhead(const queue_trace_config_t *cfg)
+{
+    uint32_t overhead = UINT32_MAX;
+
+    for (uint32_t i = 0U; i < TRACE_CALIBRATION_ROUNDS; i++)
+    {
+        const uint32_t start = cfg->now(cfg->clock_ctx);
+        const uint32_t elapsed = cfg->now(cfg->clock_ctx) - start;
+
+        overhead = (elapsed < overhead) ? elapsed : overhead;
+    }
+
+    return overhead;
+}
+
+/**
+ * @brief Close a measurement and add it to the operation's histogram.
+ *
+ * @param[in,out] t     Traced queue.
+ * @param[in]     op    Operation measured.
+ * @param[in]     start Clock value sampled before the call.
+ *
+ * @details Constant time: one clock read, one clz, no loop.
+ */
+static void trace_record(queue_trace_t *t, queue_trace_op_t op, uint32_t start)
+{
+    const uint32_t elapsed = t->cfg.now(t->cfg.clock_ctx) - start;
+    const uint32_t ticks = (elapsed > t->overhead) ? (elapsed - t->overhead) : 0U;
+    const uint32_t bucket = (ticks == 0U) ? 0U : (32U - (uint32_t)queue_clz32(ticks));
+    queue_trace_hist_t *hist = &t->hist[op];
+
+    hist->buckets[bucket] = trace_saturating_inc(hist->buckets[bucket]);
+    hist->samples = trace_saturating_inc(hist->samples);
+    hist->min = (ticks < hist->min) ? ticks : hist->min;
+    hist->max = (ticks > hist->max) ? ticks : hist->max;
+}
+
+/**
+ * @brief Increment a counter, stopping at UINT32_MAX.
+ *
+ * @param[in] value Counter value.
+ *
+ * @return value + 1, or UINT32_MAX.
+ */
+static uint32_t trace_saturating_inc(uint32_t value)
+{
+    return (value < UINT32_MAX) ? (value + 1U) : value;
+}
+
+/** @} */ /* end of queue_internal group */
@@ -0,0 +1,203 @@
+/**
+ * @file queue_trace.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Per-operation latency histograms for the generic queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Opt-in tracing layer that measures queue_push(), queue_pop() and
+ *  queue_peek() on the target, under real load, to verify the bounded and
+ *  predictable execution time of the core operations.
+ *
+ *  The implementation:
+ *  - samples a user cycle counter (e.g. DWT CYCCNT) before and after each
+ *    wrapped call and subtracts the clock read overhead measured at init,
+ *  - accumulates the durations into one log2 histogram per operation
+ *    (@ref QUEUE_TRACE_BUCKETS buckets) plus sample count, minimum and
+ *    maximum; the bucket update is one count-leading-zeros and one increment,
+ *  - exports the histograms through a dump callback and answers quantile
+ *    queries (e.g. "99.9 % of pops took fewer than N cycles"),
+ *  - avoids dynamic memory allocation and standard library dependencies.
+ *
+ * @note Calls that return QUEUE_FULL / QUEUE_EMPTY / QUEUE_ERROR are
+ *       measured too. Counters saturate instead of wrapping.
+ */
+
+#ifndef QUEUE_TRACE_H
+#define QUEUE_TRACE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Number of histogram buckets: 0 ticks, then one per power of two up to 2^32. */
+#define QUEUE_TRACE_BUCKETS 33U
+
+    /**
+     * @ingroup queue
+     * @brief Traced operation.
+     */
+    typedef enum
+    {
+        QUEUE_TRACE_PUSH = 0U, /**< queue_trace_push(). */
+        QUEUE_TRACE_POP = 1U,  /**< queue_trace_pop(). */
+        QUEUE_TRACE_PEEK = 2U, /**< queue_trace_peek(). */
+        QUEUE_TRACE_OPS = 3U   /**< Number of traced operations. */
+    } queue_trace_op_t;
+
+    /**
+     * @ingroup queue
+     * @brief Latency histogram of one operation.
+     *
+     * @details `buckets[0]` counts calls of 0 ticks and `buckets[b]` calls of
+     *          [2^(b−1), 2^b) ticks, after overhead compensation.
+     */
+    typedef struct
+    {
+        uint32_t buckets[QUEUE_TRACE_BUCKETS]; /**< Sample counts per log2 range. */
+        uint32_t samples;                      /**< Number of measured calls. */
+        uint32_t min;                          /**< Shortest call in ticks (UINT32_MAX if none). */
+        uint32_t max;                          /**< Longest call in ticks. */
+    } queue_trace_hist_t;
+
+    /**
+     * @ingroup queue
+     * @brief Configuration of a traced queue.
+     */
+    typedef struct
+    {
+        queue_clock_fn_t now; /**< Cycle counter hook (non-NULL). */
+        void *clock_ctx;      /**< Argument passed to `now`. */
+    } queue_trace_config_t;
+
+    /**
+     * @ingroup queue
+     * @brief Traced queue: an existing `queue_t` plus its histograms.
+     */
+    typedef struct
+    {
+        queue_t *queue;                           /**< Measured queue. */
+        queue_trace_config_t cfg;                 /**< Clock hook. */
+        uint32_t overhead;                        /**< Ticks of one back-to-back clock read pair. */
+        queue_trace_hist_t hist[QUEUE_TRACE_OPS]; /**< One histogram per operation. */
+    } queue_trace_t;
+
+    /**
+     * @ingroup queue
+     * @brief Dump callback, called once per operation by queue_trace_dump().
+     *
+     * @param[in] ctx  User context.
+     * @param[in] op   Operation.
+     * @param[in] hist Its histogram.
+     */
+    typedef void (*queue_trace_dump_fn_t)(void *ctx, queue_trace_op_t op, const queue_trace_hist_t *hist);
+
+    /**
+     * @ingroup queue
+     * @brief Attach a tracing layer to a queue.
+     *
+     * @param[out] t     Traced queue.
+     * @param[in]  queue Initialized queue.
+     * @param[in]  cfg   Clock hook.
+     *
+     * @retval QUEUE_OK    Success; histograms cleared, clock overhead measured.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_trace_init(queue_trace_t *t, queue_t *queue, const queue_trace_config_t *cfg);
+
+    /**
+     * @ingroup queue
+     * @brief queue_push() measured into the QUEUE_TRACE_PUSH histogram.
+     *
+     * @param[in,out] t    Traced queue.
+     * @param[in]     item Pointer to element data to add.
+     *
+     * @return Result of queue_push(), or QUEUE_ERROR if t is NULL.
+     */
+    queue_status_t queue_trace_push(queue_trace_t *t, const void *item);
+
+    /**
+     * @ingroup queue
+     * @brief queue_pop() measured into the QUEUE_TRACE_POP histogram.
+     *
+     * @param[in,out] t    Traced queue.
+     * @param[out]    item Destination buffer.
+     *
+     * @return Result of queue_pop(), or QUEUE_ERROR if t is NULL.
+     */
+    queue_status_t queue_trace_pop(queue_trace_t *t, void *item);
+
+    /**
+     * @ingroup queue
+     * @brief queue_peek() measured into the QUEUE_TRACE_PEEK histogram.
+     *
+     * @param[in,out] t    Traced queue.
+     * @param[out]    item Destination buffer.
+     *
+     * @return Result of queue_peek(), or QUEUE_ERROR if t is NULL.
+     */
+    queue_status_t queue_trace_peek(queue_trace_t *t, void *item);
+
+    /**
+     * @ingroup queue
+     * @brief Clear all histograms (the measured overhead is kept).
+     *
+     * @param[in,out] t Traced queue.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_ERROR t is NULL.
+     */
+    queue_status_t queue_trace_reset(queue_trace_t *t);
+
+    /**
+     * @ingroup queue
+     * @brief Pass every histogram to `fn`, in queue_trace_op_t order.
+     *
+     * @param[in] t   Traced queue.
+     * @param[in] fn  Dump callback (e.g. formatting JSON/CSV for a dashboard).
+     * @param[in] ctx Passed to `fn`.
+     *
+     * @retval QUEUE_OK    Success.
+     * @retval QUEUE_ERROR Invalid parameters.
+     */
+    queue_status_t queue_trace_dump(const queue_trace_t *t, queue_trace_dump_fn_t fn, void *ctx);
+
+    /**
+     * @ingroup queue
+     * @brief Upper latency bound met by a given share of the samples.
+     *
+     * @param[in]  hist     Histogram.
+     * @param[in]  permille Share of samples in 1/1000 (e.g. 999 for p99.9, 1000 for all).
+     * @param[out] ticks    Exclusive upper bound of the bucket reaching that
+     *                      share (UINT32_MAX for the last bucket); capped at
+     *                      `hist->max + 1` so a full-share query is exact.
+     *
+     * @retval QUEUE_OK    `*ticks` written.
+     * @retval QUEUE_EMPTY No samples.
+     * @retval QUEUE_ERROR Invalid parameters (NULL, permille > 1000).
+     */
+    queue_status_t queue_trace_quantile(const queue_trace_hist_t *hist, uint32_t permille, uint32_t *ticks);
+
+    /**
+     * @ingroup queue
+     * @brief Short lowercase name of an operation for reports.
+     *
+     * @param[in] op Operation.
+     *
+     * @return "push", "pop", "peek", or "?" for an invalid value.
+     */
+    const char *queue_trace_op_name(queue_trace_op_t op);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_TRACE_H */
@@ -0,0 +1,160 @@
+/**
+ * @file queue_typed.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Compile-time typed FIFO queue generator macros.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Generates a FIFO queue specialized for one element type and one capacity.
+ *  Because both are compile-time constants, elements are moved with plain
+ *  typed assignments and the wrap logic is constant-folded. The generic
+ *  `queue_t` API from queue.h stays available as the type-agnostic fallback.
+ *
+ *  - QUEUE_DECLARE(name, type, capacity) — emits the storage type `name_t`
+ *    and `static inline` functions `name_init/push/pop/peek/is_empty/is_full/count`.
+ *  - QUEUE_DEFINE(name, type, capacity) — same, plus a zero-initialized
+ *    static instance called `name`, ready to use without init.
+ *
+ *  The implementation keeps the guarantees of the generic queue:
+ *  no dynamic memory, bounded execution time, no standard library calls.
+ *  No cast is needed, so DV-QUEUE-001 does not apply.
+ *
+ * @code
+ *  QUEUE_DEFINE(sample_queue, uint32_t, 16)
+ *
+ *  uint32_t v = 42U;
+ *  (void)sample_queue_push(&sample_queue, &v);
+ *  (void)sample_queue_pop(&sample_queue, &v);
+ * @endcode
+ *
+ * @note capacity must be an integer constant in the range 1..65535.
+ */
+
+#ifndef QUEUE_TYPED_H
+#define QUEUE_TYPED_H
+
+#include "queue.h"
+#include <stddef.h> /* for NULL */
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @ingroup queue
+ * @brief Emit a typed queue storage type and its inline API.
+ *
+ * @param name     Prefix of the generated type (`name_t`) and functions.
+ * @param type     Element type.
+ * @param capacity Maximum number of elements (integer constant, 1..65535).
+ */
+#define QUEUE_DECLARE(name, type, capacity)                                                      \
+    typedef char name##_capacity_check[(((capacity) > 0) && ((capacity) <= 65535)) ? 1 : -1];    \
+                                                                                                 \
+    typedef struct                                                                               \
+    {                                                                                            \
+        type buffer[(capacity)]; /**< Element storage. */                                        \
+        uint16_t head;           /**< Read index. */                                             \
+        uint16_t tail;           /**< Write index. */                                            \
+        uint16_t count;          /**< Current number of stored elements. */                      \
+    } name##_t;                                                                                  \
+                                                                                                 \
+    static inline uint16_t name##_next(uint16_t index)                                           \
+    {                                                                                            \
+        return ((uint32_t)index + 1U == (uint32_t)(capacity)) ? 0U : (uint16_t)(index + 1U);     \
+    }                                                                                            \
+                                                                                                 \
+    static inline queue_status_t name##_init(name##_t *q)                                        \
+    {                                                                                            \
+        queue_status_t ret_status = QUEUE_ERROR;                                                 \
+        if (q != NULL)                                                                           \
+        {                                                                                        \
+            q->head = 0U;                                                                        \
+            q->tail = 0U;                                                                        \
+            q->count = 0U;                                                                       \
+            ret_status = QUEUE_OK;                                                               \
+        }                                                                                        \
+        return ret_status;                                                                       \
+    }                                                                                            \
+                                                                                                 \
+    static inline queue_status_t name##_push(name##_t *q, const type *item)                      \
+    {                                                                                            \
+        queue_status_t ret_status = QUEUE_OK;                                                    \
+        if ((q == NULL) || (item == NULL))                                                       \
+        {                                                                                        \
+            ret_status = QUEUE_ERROR;                                                            \
+        }                                                                                        \
+        else if ((uint32_t)q->count >= (uint32_t)(capacity))                                     \
+        {                                                                                        \
+            ret_status = QUEUE_FULL;                                                             \
+        }                                                                                        \
+        else                                                                                     \
+        {                                                                                        \
+            q->buffer[q->tail] = *item;                                                          \
+            q->tail = name##_next(q->tail);                                                      \
+            q->count = (uint16_t)(q->count + 1U);                                                \
+        }                                                                                        \
+        return ret_status;                                                                       \
+    }                                                                                            \
+                                                                                                 \
+    static inline queue_status_t name##_peek(const name##_t *q, type *item)                      \
+    {                                                                                            \
+        queue_status_t ret_status = QUEUE_OK;                                                    \
+        if ((q == NULL) || (item == NULL))                                                       \
+        {                                                                                        \
+            ret_status = QUEUE_ERROR;                                                            \
+        }                                                                                        \
+        else if (q->count == 0U)                                                                 \
+        {                                                                                        \
+            ret_status = QUEUE_EMPTY;                                                            \
+        }                                                                                        \
+        else                                                                                     \
+        {                                                                                        \
+            *item = q->buffer[q->head];                                                          \
+        }                                                                                        \
+        return ret_status;                                                                       \
+    }                                                                                            \
+                                                                                                 \
+    static inline queue_status_t name##_pop(name##_t *q, type *item)                             \
+    {                                                                                            \
+        queue_status_t ret_status = name##_peek(q, item);                                        \
+        if (ret_status == QUEUE_OK)                                                              \
+        {                                                                                        \
+            q->head = name##_next(q->head);                                                      \
+            q->count = (uint16_t)(q->count - 1U);                                                \
+        }                                                                                        \
+        return ret_status;                                                                       \
+    }                                                                                            \
+                                                                                                 \
+    static inline bool name##_is_empty(const name##_t *q)                                        \
+    {                                                                                            \
+        return (q == NULL) || (q->count == 0U);                                                  \
+    }                                                                                            \
+                                                                                                 \
+    static inline bool name##_is_full(const name##_t *q)                                         \
+    {                                                                                            \
+        return (q != NULL) && ((uint32_t)q->count == (uint32_t)(capacity));                      \
+    }                                                                                            \
+                                                                                                 \
+    static inline uint16_t name##_count(const name##_t *q)                                       \
+    {                                                                                            \
+        return (q == NULL) ? 0U : q->count;                                                      \
+    }
+
+/**
+ * @ingroup queue
+ * @brief Emit a typed queue (see QUEUE_DECLARE) plus a static instance `name`.
+ *
+ * @param name     Name of the static instance and prefix of the generated API.
+ * @param type     Element type.
+ * @param capacity Maximum number of elements (integer constant, 1..65535).
+ *
+ * @note The instance lives in zero-initialized static storage and is ready
+ *       to use without calling `name_init()`.
+ */
+#define QUEUE_DEFINE(name, type, capacity)  \
+    QUEUE_DECLARE(name, type, capacity)     \
+    static name##_t name;
+
+#endif /* QUEUE_TYPED_H */
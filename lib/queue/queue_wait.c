@@ -0,0 +1,176 @@
+/**
+ * @file queue_wait.c
+ * @brief Blocking wait/notify layer implementation.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Every attempt follows the same sequence: take a token from the wait
+ *  object, try the non-blocking operation under the optional lock, and
+ *  sleep on the token only if the queue was full / empty. The opposite side
+ *  is notified only when the operation moved the queue off that edge.
+ *
+ * @ingroup queue
+ */
+
+#include "queue_wait.h"
+#include <stddef.h> /* for NULL */
+
+static void wait_lock(const queue_wait_t *w);
+static void wait_unlock(const queue_wait_t *w);
+static bool wait_ops_valid(const queue_wait_config_t *cfg);
+
+/* -------------------------- */
+/* Blocking API               */
+/* -------------------------- */
+
+queue_status_t queue_wait_init(queue_wait_t *w, queue_t *queue, const queue_wait_config_t *cfg)
+{
+    queue_status_t ret_status = QUEUE_OK;
+
+    if ((w == NULL) || (queue == NULL) || (cfg == NULL))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else if (!wait_ops_valid(cfg))
+    {
+        ret_status = QUEUE_ERROR;
+    }
+    else
+    {
+        w->queue = queue;
+        w->cfg = *cfg;
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_wait_push(queue_wait_t *w, const void *item, uint32_t timeout)
+{
+    queue_status_t ret_status = QUEUE_ERROR;
+    uint32_t remaining = timeout;
+    bool retry = (w != NULL) && (item != NULL);
+
+    while (retry)
+    {
+        const uint32_t token = w->cfg.ops->prepare(w->cfg.not_full);
+        bool was_empty = false;
+
+        wait_lock(w);
+        was_empty = queue_is_empty(w->queue);
+        ret_status = queue_push(w->queue, item);
+        wait_unlock(w);
+
+        if (ret_status != QUEUE_FULL)
+        {
+            retry = false;
+            if ((ret_status == QUEUE_OK) && was_empty)
+            {
+                w->cfg.ops->notify(w->cfg.not_empty);
+            }
+        }
+        else if (remaining == 0U)
+        {
+            retry = false;
+        }
+        else
+        {
+            retry = w->cfg.ops->wait(w->cfg.not_full, token, &remaining);
+        }
+    }
+
+    return ret_status;
+}
+
+queue_status_t queue_wait_pop(queue_wait_t *w, void *item, uint32_t timeout)
+{
+    queue_status_t ret_status = QUEUE_ERROR;
+    uint32_t remaining = timeout;
+    bool retry = (w != NULL) && (item != NULL);
+
+    while (retry)
+    {
+        const uint32_t token = w->cfg.ops->prepare(w->cfg.not_empty);
+        bool was_full = false;
+
+        wait_lock(w);
+        was_full = queue_is_full(w->queue);
+        ret_status = queue_pop(w->queue, item);
+        wait_unlock(w);
+
+        if (ret_status != QUEUE_EMPTY)
+        {
+            retry = false;
+            if ((ret_status == QUEUE_OK) && was_full)
+            {
+                w->cfg.ops->notify(w->cfg.not_full);
+            }
+        }
+        else if (remaining == 0U)
+        {
+            retry = false;
+        }
+        else
+        {
+            retry = w->cfg.ops->wait(w->cfg.not_empty, token, &remaining);
+        }
+    }
+
+    return ret_status;
+}
+
+/* -------------------------- */
+/* Internal helper functions  */
+/* -------------------------- */
+/**
+ * @addtogroup queue_internal
+ * @{
+ */
+
+/**
+ * @brief Enter the configured critical section, if any.
+ *
+ * @param[in] w Blocking queue instance.
+ */
+static void wait_lock(const queue_wait_t *w)
+{
+    if (w->cfg.lock.lock != NULL)
+    {
+        w->cfg.lock.lock(w->cfg.lock.ctx);
+    }
+}
+
+/**
+ * @brief Leave the configured critical section, if any.
+ *
+ * @param[in] w Blocking queue instance.
+ */
+static void wait_unlock(const queue_wait_t *w)
+{
+    if (w->cfg.lock.unlock != NULL)
+    {
+        w->cfg.lock.unlock(w->cfg.lock.ctx);
+    }
+}
+
+/**
+ * @brief Check that a configuration is complete.
+ *
+ * @param[in] cfg Configuration to check.
+ *
+ * @return true — all backend functions set and lock hooks both set or both NULL.
+ */
+static bool wait_ops_valid(const queue_wait_config_t *cfg)
+{
+    bool valid = false;
+
+    if (cfg->ops != NULL)
+    {
+        valid = (cfg->ops->prepare != NULL) && (cfg->ops->wait != NULL) && (cfg->ops->notify != NULL) &&
+                ((cfg->lock.lock == NULL) == (cfg->lock.unlock == NULL));
+    }
+
+    return valid;
+}
+
+/** @} */ /* end of queue_internal group */
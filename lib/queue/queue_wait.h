@@ -0,0 +1,155 @@
+/**
+ * @file queue_wait.h
+ * @author
+ *      niwciu (niwciu@gmail.com)
+ * @brief
+ *      Optional blocking push/pop with timeout on top of the generic queue.
+ * @version 1.0.4
+ * @date 2026-03-05
+ *
+ * @details
+ *  Lets a task sleep until an element (or free space) is available instead
+ *  of polling queue_pop() / queue_push(). The core queue stays non-blocking
+ *  and deterministic; this layer only adds a retry loop around it and a
+ *  pluggable wait primitive (@ref queue_wait_ops_t).
+ *
+ *  The implementation:
+ *  - notifies consumers only on the empty → non-empty edge and producers
+ *    only on the full → non-full edge, so steady-state traffic issues no
+ *    kernel calls,
+ *  - takes a token from the wait object before testing the queue, so a
+ *    notification between the test and the sleep is never lost,
+ *  - serializes queue access through optional lock hooks
+ *    (@ref queue_wait_lock_t), required whenever several contexts run
+ *    truly in parallel,
+ *  - avoids dynamic memory allocation and standard library dependencies.
+ *
+ *  Backends for a Linux futex, FreeRTOS task notifications and Zephyr
+ *  k_poll signals are provided in `port/`.
+ */
+
+#ifndef QUEUE_WAIT_H
+#define QUEUE_WAIT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "queue.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Timeout value that blocks until the operation succeeds. */
+#define QUEUE_WAIT_FOREVER 0xFFFFFFFFU
+
+    /**
+     * @ingroup queue
+     * @brief Wait primitive backend.
+     *
+     * @details
+     *  A wait object is an event counter (or an equivalent latch):
+     *  - `prepare` returns a token describing the current state,
+     *  - `wait` sleeps only while no notify happened since that token was
+     *    taken, at most `*timeout` backend ticks, and stores the remaining
+     *    time back to `*timeout` (unchanged for @ref QUEUE_WAIT_FOREVER),
+     *  - `notify` wakes every context sleeping on the object.
+     *
+     *  `wait` returns false once the timeout expired, true otherwise
+     *  (including spurious wake-ups).
+     */
+    typedef struct
+    {
+        uint32_t (*prepare)(void *obj);                            /**< Take a token before testing the queue. */
+        bool (*wait)(void *obj, uint32_t token, uint32_t *timeout); /**< Sleep unless notified since `token`. */
+        void (*notify)(void *obj);                                  /**< Wake all waiters of `obj`. */
+    } queue_wait_ops_t;
+
+    /**
+     * @ingroup queue
+     * @brief Optional critical section around queue accesses.
+     *
+     * @details Both functions NULL — no locking (single context per side on a
+     *          single core, or external serialization).
+     */
+    typedef struct
+    {
+        void (*lock)(void *ctx);   /**< Enter critical section. */
+        void (*unlock)(void *ctx); /**< Leave critical section. */
+        void *ctx;                 /**< Argument passed to lock/unlock (e.g. a mutex). */
+    } queue_wait_lock_t;
+
+    /**
+     * @ingroup queue
+     * @brief Configuration of a blocking queue.
+     */
+    typedef struct
+    {
+        const queue_wait_ops_t *ops; /**< Wait primitive backend (all functions non-NULL). */
+        void *not_empty;             /**< Wait object consumers sleep on. */
+        void *not_full;              /**< Wait object producers sleep on. */
+        queue_wait_lock_t lock;      /**< Optional lock hooks. */
+    } queue_wait_config_t;
+
+    /**
+     * @ingroup queue
+     * @brief Blocking queue control structure.
+     */
+    typedef struct
+    {
+        queue_t *queue;          /**< Underlying non-blocking queue. */
+        queue_wait_config_t cfg; /**< Backend, wait objects and lock hooks. */
+    } queue_wait_t;
+
+    /**
+     * @ingroup queue
+     * @brief Attach the blocking layer to an initialized queue.
+     *
+     * @param[out] w     Pointer to blocking queue structure.
+     * @param[in]  queue Pointer to an initialized queue_t.
+     * @param[in]  cfg   Backend, wait objects and optional lock hooks (copied).
+     *
+     * @retval QUEUE_OK    Initialization succeeded.
+     * @retval QUEUE_ERROR Invalid arguments (NULL, incomplete ops or only one lock hook).
+     */
+    queue_status_t queue_wait_init(queue_wait_t *w, queue_t *queue, const queue_wait_config_t *cfg);
+
+    /**
+     * @ingroup queue
+     * @brief Push one element, waiting up to `timeout` for free space.
+     *
+     * @param[in,out] w       Pointer to blocking queue.
+     * @param[in]     item    Pointer to element data to add.
+     * @param[in]     timeout Backend ticks to wait; 0 — do not wait,
+     *                        @ref QUEUE_WAIT_FOREVER — no time limit.
+     *
+     * @retval QUEUE_OK    Element stored.
+     * @retval QUEUE_FULL  Still full when the timeout expired.
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note May block; not callable from interrupt context unless `timeout` is 0.
+     */
+    queue_status_t queue_wait_push(queue_wait_t *w, const void *item, uint32_t timeout);
+
+    /**
+     * @ingroup queue
+     * @brief Pop one element, waiting up to `timeout` for data.
+     *
+     * @param[in,out] w       Pointer to blocking queue.
+     * @param[out]    item    Pointer to destination buffer to store element.
+     * @param[in]     timeout Backend ticks to wait; 0 — do not wait,
+     *                        @ref QUEUE_WAIT_FOREVER — no time limit.
+     *
+     * @retval QUEUE_OK    Element copied to `item` and removed.
+     * @retval QUEUE_EMPTY Still empty when the timeout expired (item unchanged).
+     * @retval QUEUE_ERROR Invalid parameters.
+     *
+     * @note May block; not callable from interrupt context unless `timeout` is 0.
+     */
+    queue_status_t queue_wait_pop(queue_wait_t *w, void *item, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUEUE_WAIT_H */
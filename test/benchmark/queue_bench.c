@@ -0,0 +1,229 @@
+/**
+ * @file queue_bench.c
+ * @brief Throughput / jitter benchmark of the generic queue API.
+ *
+ * @details
+ *  Measures queue_push, queue_pop, queue_peek, a wrap-heavy push+pop pattern
+ *  and the batch API over element sizes 1..256 bytes and several capacities.
+ *  Each sample times a block of operations; per-operation mean, min, max and
+ *  jitter (max − min) are reported in the unit of the selected timing port.
+ *  The cost of reading the tick counter is calibrated and subtracted.
+ */
+
+#include "queue.h"
+#include "queue_bench_port.h"
+#include <stdio.h>
+
+#define BENCH_SAMPLES      200U
+#define BENCH_MAX_BLOCK    64U
+#define BENCH_MAX_ELEMENT  256U
+#define BENCH_MAX_CAPACITY 1024U
+
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t ops_per_sample;
+} bench_result_t;
+
+typedef uint32_t (*bench_sample_fn_t)(queue_t *q, queue_index_t ops, queue_index_t batch);
+
+static uint32_t storage[(BENCH_MAX_ELEMENT * BENCH_MAX_CAPACITY) / sizeof(uint32_t)];
+static uint32_t items[(BENCH_MAX_ELEMENT * BENCH_MAX_BLOCK) / sizeof(uint32_t)];
+static uint32_t timer_overhead;
+
+static uint32_t elapsed_since(uint32_t start)
+{
+    const uint32_t ticks = bench_port_ticks() - start;
+
+    return (ticks > timer_overhead) ? (ticks - timer_overhead) : 0U;
+}
+
+static void calibrate_timer(void)
+{
+    uint32_t best = UINT32_MAX;
+
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        const uint32_t start = bench_port_ticks();
+        const uint32_t ticks = bench_port_ticks() - start;
+
+        best = (ticks < best) ? ticks : best;
+    }
+    timer_overhead = best;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Timed blocks: each returns the ticks spent on `ops` measured operations */
+/* ---------------------------------------------------------------------- */
+
+static uint32_t sample_push(queue_t *q, queue_index_t ops, queue_index_t batch)
+{
+    queue_index_t moved = 0U;
+    uint32_t start = 0U;
+    uint32_t ticks = 0U;
+
+    (void)batch;
+    start = bench_port_ticks();
+    for (queue_index_t i = 0U; i < ops; i++)
+    {
+        (void)queue_push(q, items);
+    }
+    ticks = elapsed_since(start);
+    (void)queue_pop_n(q, items, ops, &moved);
+
+    return ticks;
+}
+
+static uint32_t sample_pop(queue_t *q, queue_index_t ops, queue_index_t batch)
+{
+    queue_index_t moved = 0U;
+    uint32_t start = 0U;
+
+    (void)batch;
+    (void)queue_push_n(q, items, ops, &moved);
+    start = bench_port_ticks();
+    for (queue_index_t i = 0U; i < ops; i++)
+    {
+        (void)queue_pop(q, items);
+    }
+
+    return elapsed_since(start);
+}
+
+static uint32_t sample_peek(queue_t *q, queue_index_t ops, queue_index_t batch)
+{
+    uint32_t start = 0U;
+    uint32_t ticks = 0U;
+
+    (void)batch;
+    (void)queue_push(q, items);
+    start = bench_port_ticks();
+    for (queue_index_t i = 0U; i < ops; i++)
+    {
+        (void)queue_peek(q, items);
+    }
+    ticks = elapsed_since(start);
+    (void)queue_pop(q, items);
+
+    return ticks;
+}
+
+/* One push + one pop per operation; indices wrap every `capacity` operations. */
+static uint32_t sample_push_pop(queue_t *q, queue_index_t ops, queue_index_t batch)
+{
+    uint32_t start = 0U;
+
+    (void)batch;
+    start = bench_port_ticks();
+    for (queue_index_t i = 0U; i < ops; i++)
+    {
+        (void)queue_push(q, items);
+        (void)queue_pop(q, items);
+    }
+
+    return elapsed_since(start);
+}
+
+/* `ops` elements pushed and popped in blocks of `batch` elements. */
+static uint32_t sample_batch(queue_t *q, queue_index_t ops, queue_index_t batch)
+{
+    queue_index_t moved = 0U;
+    uint32_t start = 0U;
+
+    start = bench_port_ticks();
+    for (queue_index_t done = 0U; done < ops; done = (queue_index_t)(done + batch))
+    {
+        (void)queue_push_n(q, items, batch, &moved);
+        (void)queue_pop_n(q, items, batch, &moved);
+    }
+
+    return elapsed_since(start);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Driver                                                                 */
+/* ---------------------------------------------------------------------- */
+
+static bench_result_t run_case(bench_sample_fn_t fn, queue_index_t size, queue_index_t capacity, queue_index_t batch)
+{
+    bench_result_t result = {UINT32_MAX, 0U, 0U, 0U};
+    queue_t q;
+    queue_index_t ops = (capacity < BENCH_MAX_BLOCK) ? capacity : (queue_index_t)BENCH_MAX_BLOCK;
+
+    ops = (queue_index_t)(ops - (ops % batch));
+    result.ops_per_sample = ops;
+    (void)queue_init(&q, storage, size, capacity);
+
+    for (uint32_t s = 0U; s < (BENCH_SAMPLES + 10U); s++)
+    {
+        const uint32_t ticks = fn(&q, ops, batch);
+
+        if (s >= 10U) /* first samples warm up caches and branch predictors */
+        {
+            result.min = (ticks < result.min) ? ticks : result.min;
+            result.max = (ticks > result.max) ? ticks : result.max;
+            result.sum += ticks;
+        }
+    }
+
+    return result;
+}
+
+static void print_result(const char *op, queue_index_t size, queue_index_t capacity, queue_index_t batch, bench_result_t r)
+{
+    const double ops = (double)r.ops_per_sample;
+    const double mean = ((double)r.sum / (double)BENCH_SAMPLES) / ops;
+    const double min = (double)r.min / ops;
+    const double max = (double)r.max / ops;
+
+    printf("%-10s %6u %6u %6u %10.2f %10.2f %10.2f %10.2f\n",
+           op, (unsigned)size, (unsigned)capacity, (unsigned)batch, mean, min, max, max - min);
+}
+
+int main(void)
+{
+    static const queue_index_t sizes[] = {1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 256U};
+    static const queue_index_t capacities[] = {8U, 64U, 1024U};
+    static const queue_index_t batches[] = {4U, 16U, 64U};
+    static const struct
+    {
+        const char *name;
+        bench_sample_fn_t fn;
+    } single_ops[] = {
+        {"push", sample_push},
+        {"pop", sample_pop},
+        {"peek", sample_peek},
+        {"push+pop", sample_push_pop},
+    };
+
+    bench_port_init();
+    calibrate_timer();
+
+    printf("QUEUE_LIB benchmark, per-operation values in %s (timer overhead %u subtracted)\n",
+           bench_port_unit(), (unsigned)timer_overhead);
+    printf("%-10s %6s %6s %6s %10s %10s %10s %10s\n", "op", "size", "cap", "batch", "mean", "min", "max", "jitter");
+
+    for (size_t s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+        for (size_t c = 0U; c < (sizeof(capacities) / sizeof(capacities[0])); c++)
+        {
+            for (size_t o = 0U; o < (sizeof(single_ops) / sizeof(single_ops[0])); o++)
+            {
+                print_result(single_ops[o].name, sizes[s], capacities[c], 1U,
+                             run_case(single_ops[o].fn, sizes[s], capacities[c], 1U));
+            }
+            for (size_t b = 0U; b < (sizeof(batches) / sizeof(batches[0])); b++)
+            {
+                if (batches[b] <= capacities[c])
+                {
+                    print_result("batch", sizes[s], capacities[c], batches[b],
+                                 run_case(sample_batch, sizes[s], capacities[c], batches[b]));
+                }
+            }
+        }
+    }
+
+    return 0;
+}
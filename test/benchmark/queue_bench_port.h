@@ -0,0 +1,26 @@
+/**
+ * @file queue_bench_port.h
+ * @brief Timing port used by the queue benchmark.
+ *
+ * @details
+ *  A port provides a free-running 32-bit tick counter. Differences are
+ *  computed modulo 2^32, so the counter may wrap between samples.
+ *  - queue_bench_port_host.c — monotonic clock, ticks are nanoseconds,
+ *  - queue_bench_port_dwt.c  — Cortex-M DWT CYCCNT, ticks are CPU cycles.
+ */
+
+#ifndef QUEUE_BENCH_PORT_H
+#define QUEUE_BENCH_PORT_H
+
+#include <stdint.h>
+
+/** @brief Prepare the tick source (enable counters etc.). */
+void bench_port_init(void);
+
+/** @brief Current value of the free-running tick counter. */
+uint32_t bench_port_ticks(void);
+
+/** @brief Unit of one tick, used in the report header (e.g. "ns", "cycles"). */
+const char *bench_port_unit(void);
+
+#endif /* QUEUE_BENCH_PORT_H */
@@ -0,0 +1,31 @@
+/**
+ * @file queue_bench_port_dwt.c
+ * @brief Benchmark timing port for Cortex-M3/M4/M7/M33 (DWT CYCCNT, ticks in cycles).
+ *
+ * @note Cortex-M0/M0+ have no CYCCNT; provide a SysTick based port there.
+ */
+
+#include "queue_bench_port.h"
+
+#define DEMCR_REG       (*(volatile uint32_t *)0xE000EDFCUL)
+#define DWT_CTRL_REG    (*(volatile uint32_t *)0xE0001000UL)
+#define DWT_CYCCNT_REG  (*(volatile uint32_t *)0xE0001004UL)
+#define DEMCR_TRCENA    (1UL << 24)
+#define DWT_CTRL_CYCENA (1UL << 0)
+
+void bench_port_init(void)
+{
+    DEMCR_REG |= DEMCR_TRCENA;
+    DWT_CYCCNT_REG = 0U;
+    DWT_CTRL_REG |= DWT_CTRL_CYCENA;
+}
+
+uint32_t bench_port_ticks(void)
+{
+    return DWT_CYCCNT_REG;
+}
+
+const char *bench_port_unit(void)
+{
+    return "cycles";
+}
@@ -0,0 +1,27 @@
+/**
+ * @file queue_bench_port_host.c
+ * @brief Benchmark timing port for POSIX hosts (CLOCK_MONOTONIC, ticks in ns).
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "queue_bench_port.h"
+#include <time.h>
+
+void bench_port_init(void)
+{
+}
+
+uint32_t bench_port_ticks(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec);
+}
+
+const char *bench_port_unit(void)
+{
+    return "ns";
+}
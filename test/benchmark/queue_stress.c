@@ -0,0 +1,492 @@
+/**
+ * @file queue_stress.c
+ * @brief Multi-threaded contention stress test of the concurrent queue variants.
+ *
+ * @details
+ *  Runs P producer and C consumer threads (POSIX threads) against the SPSC,
+ *  MPMC, MPMC frame (push_all / pop_exact), shared-memory and blocking
+ *  (queue_t + queue_wait + mutex) variants for several element sizes.
+ *
+ *  Every element carries its producer id, a per-producer sequence number and
+ *  a fill pattern derived from both. Consumers check that:
+ *  - the fill pattern is intact (no torn copy),
+ *  - elements of one producer arrive in increasing order (per-producer FIFO),
+ *  - the elements of one frame are consecutive (frame variants),
+ *  and after the run every sequence number must have been received exactly
+ *  once (no loss, no duplication).
+ *
+ *  Each line reports the throughput in million elements per second; the
+ *  process exits with 1 if any check failed. Build with
+ *  QUEUE_STRESS_SANITIZER=thread or =address to run under TSan / ASan.
+ *
+ *  Usage: QUEUE_stress [elements_per_case]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "queue.h"
+#include "queue_mpmc.h"
+#include "queue_shm.h"
+#include "queue_spsc.h"
+#include "queue_wait.h"
+#include "port/queue_wait_futex.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define STRESS_MAX_THREADS      4U
+#define STRESS_MAX_ELEMENTS     (1UL << 22)
+#define STRESS_DEFAULT_ELEMENTS 200000UL
+#define STRESS_MAX_ELEMENT      128U
+#define STRESS_MAX_FRAME        4U
+#define STRESS_CAPACITY         256U
+#define STRESS_WAIT_MS          1U
+
+/** @brief Element header; the rest of the element is a fill pattern. */
+typedef struct
+{
+    uint32_t producer;
+    uint32_t seq;
+} stress_header_t;
+
+/** @brief Storage shared by all variants (one case runs at a time). */
+typedef struct
+{
+    queue_t queue;
+    queue_wait_t wait;
+    queue_wait_futex_t not_empty;
+    queue_wait_futex_t not_full;
+    pthread_mutex_t lock;
+    queue_spsc_t spsc;
+    queue_mpmc_t mpmc;
+    queue_shm_t shm;
+} stress_queue_t;
+
+/** @brief One queue variant under test. */
+typedef struct
+{
+    const char *name;
+    uint32_t max_producers;
+    uint32_t max_consumers;
+    uint16_t frame;
+    bool (*init)(stress_queue_t *q, uint16_t element_size);
+    bool (*push)(stress_queue_t *q, const void *items);
+    bool (*pop)(stress_queue_t *q, void *items);
+} stress_variant_t;
+
+/** @brief State of the running case. */
+typedef struct
+{
+    const stress_variant_t *variant;
+    stress_queue_t *queue;
+    uint16_t element_size;
+    uint32_t producers;
+    uint32_t per_producer;
+    uint32_t total;
+    uint32_t consumed;
+    uint32_t errors;
+} stress_case_t;
+
+/** @brief Argument of one thread. */
+typedef struct
+{
+    stress_case_t *run;
+    uint32_t id;
+} stress_thread_t;
+
+static uint8_t storage[STRESS_CAPACITY * STRESS_MAX_ELEMENT];
+static queue_mpmc_atomic_t mpmc_seq[STRESS_CAPACITY];
+static uint64_t shm_region[((STRESS_CAPACITY * (STRESS_MAX_ELEMENT + 4U)) + 1024U) / sizeof(uint64_t)];
+static uint8_t seen[STRESS_MAX_ELEMENTS];
+
+/* ---------------------------------------------------------------------- */
+/* Variants                                                               */
+/* ---------------------------------------------------------------------- */
+
+static bool spsc_init(stress_queue_t *q, uint16_t element_size)
+{
+    return queue_spsc_init(&q->spsc, storage, element_size, STRESS_CAPACITY) == QUEUE_OK;
+}
+
+static bool spsc_push(stress_queue_t *q, const void *items)
+{
+    return queue_spsc_push(&q->spsc, items) == QUEUE_OK;
+}
+
+static bool spsc_pop(stress_queue_t *q, void *items)
+{
+    return queue_spsc_pop(&q->spsc, items) == QUEUE_OK;
+}
+
+static bool mpmc_init(stress_queue_t *q, uint16_t element_size)
+{
+    static const queue_mpmc_storage_t mpmc_storage = {storage, mpmc_seq};
+
+    return queue_mpmc_init(&q->mpmc, &mpmc_storage, element_size, STRESS_CAPACITY) == QUEUE_OK;
+}
+
+static bool mpmc_push(stress_queue_t *q, const void *items)
+{
+    return queue_mpmc_push(&q->mpmc, items) == QUEUE_OK;
+}
+
+static bool mpmc_pop(stress_queue_t *q, void *items)
+{
+    return queue_mpmc_pop(&q->mpmc, items) == QUEUE_OK;
+}
+
+static bool mpmc_push_frame(stress_queue_t *q, const void *items)
+{
+    return queue_mpmc_push_all(&q->mpmc, items, STRESS_MAX_FRAME) == QUEUE_OK;
+}
+
+static bool mpmc_pop_frame(stress_queue_t *q, void *items)
+{
+    return queue_mpmc_pop_exact(&q->mpmc, items, STRESS_MAX_FRAME) == QUEUE_OK;
+}
+
+static bool shm_init(stress_queue_t *q, uint16_t element_size)
+{
+    const queue_shm_config_t cfg = {element_size, STRESS_CAPACITY};
+
+    return queue_shm_create(&q->shm, shm_region, sizeof(shm_region), &cfg) == QUEUE_OK;
+}
+
+static bool shm_push(stress_queue_t *q, const void *items)
+{
+    return queue_shm_push(&q->shm, items) == QUEUE_OK;
+}
+
+static bool shm_pop(stress_queue_t *q, void *items)
+{
+    return queue_shm_pop(&q->shm, items) == QUEUE_OK;
+}
+
+static void wait_lock(void *ctx)
+{
+    (void)pthread_mutex_lock((pthread_mutex_t *)ctx);
+}
+
+static void wait_unlock(void *ctx)
+{
+    (void)pthread_mutex_unlock((pthread_mutex_t *)ctx);
+}
+
+static bool wait_init(stress_queue_t *q, uint16_t element_size)
+{
+    const queue_wait_config_t cfg = {&queue_wait_futex_ops, &q->not_empty, &q->not_full,
+                                     {wait_lock, wait_unlock, &q->lock}};
+
+    queue_wait_futex_init(&q->not_empty);
+    queue_wait_futex_init(&q->not_full);
+
+    return (queue_init(&q->queue, storage, element_size, STRESS_CAPACITY) == QUEUE_OK) &&
+           (queue_wait_init(&q->wait, &q->queue, &cfg) == QUEUE_OK);
+}
+
+static bool wait_push(stress_queue_t *q, const void *items)
+{
+    return queue_wait_push(&q->wait, items, STRESS_WAIT_MS) == QUEUE_OK;
+}
+
+/* bounded wait so consumers notice when the other consumers took the last element */
+static bool wait_pop(stress_queue_t *q, void *items)
+{
+    return queue_wait_pop(&q->wait, items, STRESS_WAIT_MS) == QUEUE_OK;
+}
+
+static const stress_variant_t variants[] = {
+    {"spsc", 1U, 1U, 1U, spsc_init, spsc_push, spsc_pop},
+    {"mpmc", STRESS_MAX_THREADS, STRESS_MAX_THREADS, 1U, mpmc_init, mpmc_push, mpmc_pop},
+    {"mpmc-frame", STRESS_MAX_THREADS, STRESS_MAX_THREADS, STRESS_MAX_FRAME, mpmc_init, mpmc_push_frame, mpmc_pop_frame},
+    {"shm", STRESS_MAX_THREADS, STRESS_MAX_THREADS, 1U, shm_init, shm_push, shm_pop},
+    {"wait+mutex", STRESS_MAX_THREADS, STRESS_MAX_THREADS, 1U, wait_init, wait_push, wait_pop},
+};
+
+/* ---------------------------------------------------------------------- */
+/* Element encoding and checks                                            */
+/* ---------------------------------------------------------------------- */
+
+static uint8_t fill_byte(uint32_t producer, uint32_t seq, uint32_t offset)
+{
+    return (uint8_t)((producer * 31U) + seq + offset);
+}
+
+static void encode(uint8_t *element, uint16_t element_size, uint32_t producer, uint32_t seq)
+{
+    stress_header_t header = {producer, seq};
+
+    for (uint32_t i = 0U; i < sizeof(header); i++)
+    {
+        element[i] = ((const uint8_t *)&header)[i];
+    }
+    for (uint32_t i = (uint32_t)sizeof(header); i < element_size; i++)
+    {
+        element[i] = fill_byte(producer, seq, i);
+    }
+}
+
+static bool decode(const uint8_t *element, uint16_t element_size, stress_header_t *header)
+{
+    bool intact = true;
+
+    for (uint32_t i = 0U; i < sizeof(*header); i++)
+    {
+        ((uint8_t *)header)[i] = element[i];
+    }
+    for (uint32_t i = (uint32_t)sizeof(*header); i < element_size; i++)
+    {
+        intact = intact && (element[i] == fill_byte(header->producer, header->seq, i));
+    }
+
+    return intact;
+}
+
+static void report_error(stress_case_t *run, const char *what, const stress_header_t *header)
+{
+    if (__atomic_fetch_add(&run->errors, 1U, __ATOMIC_RELAXED) < 8U)
+    {
+        fprintf(stderr, "%s: %s (producer %u, seq %u)\n", run->variant->name, what, (unsigned)header->producer,
+                (unsigned)header->seq);
+    }
+}
+
+/* Returns false if the element cannot be attributed to a producer. */
+static bool check_element(stress_case_t *run, const uint8_t *element, uint32_t *last_seq, stress_header_t *header)
+{
+    bool valid = decode(element, run->element_size, header);
+
+    if (!valid || (header->producer >= run->producers) || (header->seq >= run->per_producer))
+    {
+        report_error(run, "corrupted element", header);
+        valid = false;
+    }
+    else
+    {
+        if ((last_seq[header->producer] != UINT32_MAX) && (header->seq <= last_seq[header->producer]))
+        {
+            report_error(run, "per-producer order violated", header);
+        }
+        last_seq[header->producer] = header->seq;
+        (void)__atomic_fetch_add(&seen[(header->producer * run->per_producer) + header->seq], 1U, __ATOMIC_RELAXED);
+    }
+
+    return valid;
+}
+
+static void check_frame(stress_case_t *run, const uint8_t *frame, uint32_t *last_seq)
+{
+    stress_header_t first = {0U, 0U};
+    stress_header_t header = {0U, 0U};
+
+    for (uint32_t k = 0U; k < run->variant->frame; k++)
+    {
+        const bool valid = check_element(run, &frame[k * run->element_size], last_seq, &header);
+
+        if (k == 0U)
+        {
+            first = header;
+        }
+        else if (valid && ((header.producer != first.producer) || (header.seq != (first.seq + k))))
+        {
+            report_error(run, "frame interleaved", &header);
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* Threads                                                                */
+/* ---------------------------------------------------------------------- */
+
+static void *producer_main(void *arg)
+{
+    const stress_thread_t *self = (const stress_thread_t *)arg;
+    stress_case_t *run = self->run;
+    const uint16_t frame = run->variant->frame;
+    uint8_t items[STRESS_MAX_FRAME * STRESS_MAX_ELEMENT];
+
+    for (uint32_t seq = 0U; seq < run->per_producer; seq += frame)
+    {
+        for (uint32_t k = 0U; k < frame; k++)
+        {
+            encode(&items[k * run->element_size], run->element_size, self->id, seq + k);
+        }
+        while (!run->variant->push(run->queue, items))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static void *consumer_main(void *arg)
+{
+    const stress_thread_t *self = (const stress_thread_t *)arg;
+    stress_case_t *run = self->run;
+    const uint16_t frame = run->variant->frame;
+    uint8_t items[STRESS_MAX_FRAME * STRESS_MAX_ELEMENT];
+    uint32_t last_seq[STRESS_MAX_THREADS];
+
+    for (uint32_t p = 0U; p < STRESS_MAX_THREADS; p++)
+    {
+        last_seq[p] = UINT32_MAX;
+    }
+    while (__atomic_load_n(&run->consumed, __ATOMIC_RELAXED) < run->total)
+    {
+        if (run->variant->pop(run->queue, items))
+        {
+            check_frame(run, items, last_seq);
+            (void)__atomic_fetch_add(&run->consumed, frame, __ATOMIC_RELAXED);
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Driver                                                                 */
+/* ---------------------------------------------------------------------- */
+
+static double now_seconds(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + ((double)now.tv_nsec * 1e-9);
+}
+
+static uint32_t count_lost_or_duplicated(const stress_case_t *run)
+{
+    uint32_t bad = 0U;
+
+    for (uint32_t i = 0U; i < run->total; i++)
+    {
+        bad += (seen[i] != 1U) ? 1U : 0U;
+    }
+
+    return bad;
+}
+
+static bool start_threads(stress_thread_t *args, pthread_t *threads, uint32_t count, void *(*fn)(void *))
+{
+    bool started = true;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        started = started && (pthread_create(&threads[i], NULL, fn, &args[i]) == 0);
+    }
+
+    return started;
+}
+
+/* Returns the throughput in million elements per second, or a negative value on failure. */
+static double run_case(stress_case_t *run, uint32_t consumers)
+{
+    const uint32_t producers = run->producers;
+    stress_thread_t args[2U * STRESS_MAX_THREADS];
+    pthread_t threads[2U * STRESS_MAX_THREADS];
+    double start = 0.0;
+    double elapsed = 0.0;
+    bool started = false;
+
+    run->total = producers * run->per_producer;
+    run->consumed = 0U;
+    run->errors = 0U;
+    for (uint32_t i = 0U; i < run->total; i++)
+    {
+        seen[i] = 0U;
+    }
+    for (uint32_t i = 0U; i < (producers + consumers); i++)
+    {
+        args[i].run = run;
+        args[i].id = (i < producers) ? i : (i - producers);
+    }
+
+    start = now_seconds();
+    started = start_threads(&args[producers], &threads[producers], consumers, consumer_main) &&
+              start_threads(args, threads, producers, producer_main);
+    if (!started)
+    {
+        fprintf(stderr, "pthread_create failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (uint32_t i = 0U; i < (producers + consumers); i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+    }
+    elapsed = now_seconds() - start;
+    run->errors += count_lost_or_duplicated(run);
+
+    return (run->errors == 0U) ? (((double)run->total / elapsed) * 1e-6) : -1.0;
+}
+
+/* Runs one variant with one thread mix over all element sizes; returns the number of failed cases. */
+static uint32_t run_variant(const stress_variant_t *variant, uint32_t producers, uint32_t consumers,
+                            unsigned long elements)
+{
+    static const uint16_t sizes[] = {8U, 32U, 128U};
+    static stress_queue_t queue;
+    static bool lock_ready = false;
+    const uint32_t per_producer = (uint32_t)(elements / producers);
+    uint32_t failures = 0U;
+
+    if (!lock_ready)
+    {
+        lock_ready = (pthread_mutex_init(&queue.lock, NULL) == 0);
+    }
+    for (size_t s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+        stress_case_t run = {variant, &queue, sizes[s], producers, per_producer - (per_producer % variant->frame),
+                             0U, 0U, 0U};
+        double mops = -1.0;
+
+        if (lock_ready && variant->init(&queue, sizes[s]))
+        {
+            mops = run_case(&run, consumers);
+        }
+        else
+        {
+            fprintf(stderr, "%s: init failed\n", variant->name);
+        }
+        failures += (mops < 0.0) ? 1U : 0U;
+        printf("%-12s %5u %5u %6u %10.2f %8s\n", variant->name, (unsigned)producers, (unsigned)consumers,
+               (unsigned)sizes[s], (mops < 0.0) ? 0.0 : mops, (mops < 0.0) ? "FAIL" : "ok");
+    }
+
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    static const uint32_t threads[][2] = {{1U, 1U}, {2U, 1U}, {1U, 2U}, {2U, 2U}, {4U, 4U}};
+    unsigned long elements = (argc > 1) ? strtoul(argv[1], NULL, 10) : STRESS_DEFAULT_ELEMENTS;
+    uint32_t failures = 0U;
+
+    elements = ((elements == 0UL) || (elements > STRESS_MAX_ELEMENTS)) ? STRESS_DEFAULT_ELEMENTS : elements;
+
+    printf("QUEUE_LIB stress test, %lu elements per case, capacity %u\n", elements, (unsigned)STRESS_CAPACITY);
+    printf("%-12s %5s %5s %6s %10s %8s\n", "variant", "prod", "cons", "size", "Mops/s", "result");
+
+    for (size_t v = 0U; v < (sizeof(variants) / sizeof(variants[0])); v++)
+    {
+        for (size_t t = 0U; t < (sizeof(threads) / sizeof(threads[0])); t++)
+        {
+            if ((threads[t][0] <= variants[v].max_producers) && (threads[t][1] <= variants[v].max_consumers))
+            {
+                failures += run_variant(&variants[v], threads[t][0], threads[t][1], elements);
+            }
+        }
+    }
+    printf("%s\n", (failures == 0U) ? "PASS" : "FAIL");
+
+    return (failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
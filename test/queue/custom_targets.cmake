@@ -171,3 +171,37 @@ add_custom_target(format_test
     COMMAND clang-format -i -style=file ../*.c
     COMMENT "Formatting test source code"
 )
+
+
+# -------------------------
+# Performance Benchmark
+# -------------------------
+message(STATUS "To run benchmarks (Release build of ../benchmark), use target: bench")
+add_custom_target(bench
+    COMMAND ${CMAKE_COMMAND} -S ${CMAKE_CURRENT_SOURCE_DIR}/../benchmark -B bench_build -DCMAKE_BUILD_TYPE=Release
+    COMMAND ${CMAKE_COMMAND} --build bench_build
+    COMMAND bench_build/QUEUE_bench
+    WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+    COMMENT "Building and running queue benchmarks"
+)
+
+# -------------------------
+# Contention Stress Test
+# -------------------------
+message(STATUS "To run the multi-threaded stress test (plain, TSan, ASan build of ../benchmark), use targets: stress, stress_tsan, stress_asan")
+foreach(STRESS_VARIANT IN ITEMS none thread address)
+    if(STRESS_VARIANT STREQUAL "none")
+        set(STRESS_TARGET stress)
+    elseif(STRESS_VARIANT STREQUAL "thread")
+        set(STRESS_TARGET stress_tsan)
+    else()
+        set(STRESS_TARGET stress_asan)
+    endif()
+    add_custom_target(${STRESS_TARGET}
+        COMMAND ${CMAKE_COMMAND} -S ${CMAKE_CURRENT_SOURCE_DIR}/../benchmark -B ${STRESS_TARGET}_build -DCMAKE_BUILD_TYPE=RelWithDebInfo -DQUEUE_STRESS_SANITIZER=${STRESS_VARIANT}
+        COMMAND ${CMAKE_COMMAND} --build ${STRESS_TARGET}_build --target QUEUE_stress
+        COMMAND ${STRESS_TARGET}_build/QUEUE_stress
+        WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+        COMMENT "Building and running queue stress test (sanitizer: ${STRESS_VARIANT})"
+    )
+endforeach()
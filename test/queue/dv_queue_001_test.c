@@ -8,7 +8,7 @@
 static queue_t dv_queue;
 static int dv_buffer[DV_QUEUE_CAPACITY];
 
-extern void copy_bytes(uint8_t *dst, const uint8_t *src, uint16_t size);
+extern void copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t size);
 
 TEST_GROUP(DV_QUEUE_001);
 
@@ -0,0 +1,162 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define QUEUE_CAPACITY 5
+
+static queue_t q;
+static int buffer[QUEUE_CAPACITY];
+
+TEST_GROUP(queue_batch);
+
+TEST_SETUP(queue_batch)
+{
+    queue_init(&q, buffer, sizeof(int), QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_batch)
+{
+}
+
+// Test pushing a block that fits into free space
+TEST(queue_batch, GivenEmptyQueueWhenPushNThenAllItemsAddedInOrder)
+{
+    int in[3] = {1, 2, 3};
+    int out = 0;
+    queue_index_t pushed = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, 3U, &pushed));
+    TEST_ASSERT_EQUAL_UINT16(3U, pushed);
+    TEST_ASSERT_EQUAL(3, q.count);
+
+    for (int i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+        TEST_ASSERT_EQUAL_INT(in[i], out);
+    }
+}
+
+// Test pushing more items than free space - only the fitting prefix is added
+TEST(queue_batch, GivenPartiallyFilledQueueWhenPushNExceedsFreeSpaceThenPrefixAdded)
+{
+    int in[4] = {10, 11, 12, 13};
+    int first = 9;
+    queue_index_t pushed = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &first));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &first));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, 4U, &pushed));
+
+    TEST_ASSERT_EQUAL_UINT16(3U, pushed);
+    TEST_ASSERT_TRUE(queue_is_full(&q));
+}
+
+// Test pushing into a full queue
+TEST(queue_batch, GivenFullQueueWhenPushNThenReturnsQueueFull)
+{
+    int in[QUEUE_CAPACITY] = {1, 2, 3, 4, 5};
+    queue_index_t pushed = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, QUEUE_CAPACITY, &pushed));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_push_n(&q, in, 1U, &pushed));
+    TEST_ASSERT_EQUAL_UINT16(0U, pushed);
+    TEST_ASSERT_EQUAL(QUEUE_CAPACITY, q.count);
+}
+
+// Test popping from an empty queue
+TEST(queue_batch, GivenEmptyQueueWhenPopNThenReturnsQueueEmptyAndItemsUnchanged)
+{
+    int out[2] = {-1, -1};
+    queue_index_t popped = 7U;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_pop_n(&q, out, 2U, &popped));
+    TEST_ASSERT_EQUAL_UINT16(0U, popped);
+    TEST_ASSERT_EQUAL_INT(-1, out[0]);
+    TEST_ASSERT_EQUAL_INT(-1, out[1]);
+}
+
+// Test popping more items than stored - only stored items are returned
+TEST(queue_batch, GivenQueueWhenPopNExceedsCountThenAllStoredItemsReturned)
+{
+    int in[2] = {4, 5};
+    int out[4] = {0};
+    queue_index_t pushed = 0U;
+    queue_index_t popped = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, 2U, &pushed));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&q, out, 4U, &popped));
+
+    TEST_ASSERT_EQUAL_UINT16(2U, popped);
+    TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 2);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test block copies split at the wrap point for both push and pop
+TEST(queue_batch, GivenWrapAroundWhenPushNAndPopNThenOrderIsPreserved)
+{
+    int in[QUEUE_CAPACITY] = {1, 2, 3, 4, 5};
+    int more[3] = {6, 7, 8};
+    int out[QUEUE_CAPACITY] = {0};
+    int expected[QUEUE_CAPACITY] = {4, 5, 6, 7, 8};
+    queue_index_t pushed = 0U;
+    queue_index_t popped = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, QUEUE_CAPACITY, &pushed));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&q, out, 3U, &popped));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, more, 3U, &pushed));
+
+    TEST_ASSERT_EQUAL_UINT16(3U, pushed);
+    TEST_ASSERT_EQUAL(3, q.tail);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&q, out, QUEUE_CAPACITY, &popped));
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_CAPACITY, popped);
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, out, QUEUE_CAPACITY);
+    TEST_ASSERT_EQUAL(3, q.head);
+}
+
+// Test block copies wrap the indices back into range at the maximum 16-bit capacity
+TEST(queue_batch, GivenMaxCapacityWhenBatchCrossesWrapThenIndexWrapsInRange)
+{
+    queue_t big_queue;
+    static uint8_t big_buffer[65535U];
+    const uint8_t items[4] = {1U, 2U, 3U, 4U};
+    uint8_t out[4] = {0U};
+    queue_index_t moved = 0U;
+
+    (void)queue_init(&big_queue, big_buffer, 1U, 65535U);
+    big_queue.head = 65533U;
+    big_queue.tail = 65533U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&big_queue, items, 4U, &moved));
+    TEST_ASSERT_EQUAL_UINT32(2U, big_queue.tail);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&big_queue, out, 4U, &moved));
+    TEST_ASSERT_EQUAL_UINT32(2U, big_queue.head);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(items, out, 4U);
+}
+
+// Test zero-length requests are valid no-ops
+TEST(queue_batch, GivenZeroLengthRequestThenReturnsOkAndStateUnchanged)
+{
+    int item = 1;
+    queue_index_t moved = 9U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, &item, 0U, &moved));
+    TEST_ASSERT_EQUAL_UINT16(0U, moved);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&q, &item, 0U, &moved));
+    TEST_ASSERT_EQUAL_UINT16(0U, moved);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test NULL parameters are rejected
+TEST(queue_batch, GivenNullParamsWhenPushNOrPopNThenReturnsError)
+{
+    int items[2] = {0};
+    queue_index_t moved = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_n(NULL, items, 2U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_n(&q, NULL, 2U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_n(&q, items, 2U, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_pop_n(NULL, items, 2U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_pop_n(&q, NULL, 2U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_pop_n(&q, items, 2U, NULL));
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
\ No newline at end of file
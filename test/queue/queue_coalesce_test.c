@@ -0,0 +1,171 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define QUEUE_CAPACITY 3
+
+typedef struct
+{
+    uint8_t id;
+    uint8_t value;
+} status_event_t;
+
+static queue_t q;
+static status_event_t buffer[QUEUE_CAPACITY];
+static uint32_t equal_calls;
+
+static bool same_id(const void *queued, const void *item)
+{
+    equal_calls++;
+    return ((const status_event_t *)queued)->id == ((const status_event_t *)item)->id;
+}
+
+static const queue_coalesce_t replace_policy = {same_id, QUEUE_COALESCE_REPLACE};
+static const queue_coalesce_t drop_policy = {same_id, QUEUE_COALESCE_DROP};
+
+TEST_GROUP(queue_coalesce);
+
+TEST_SETUP(queue_coalesce)
+{
+    queue_init(&q, buffer, sizeof(status_event_t), QUEUE_CAPACITY);
+    equal_calls = 0U;
+}
+
+TEST_TEAR_DOWN(queue_coalesce)
+{
+}
+
+// Test the first element is pushed without consulting the comparator
+TEST(queue_coalesce, GivenEmptyQueueWhenPushCoalesceThenElementAddedWithoutCompare)
+{
+    status_event_t ev = {1U, 10U};
+    bool coalesced = true;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_coalesce(&q, &ev, &replace_policy, &coalesced));
+    TEST_ASSERT_FALSE(coalesced);
+    TEST_ASSERT_EQUAL_UINT32(1U, queue_count(&q));
+    TEST_ASSERT_EQUAL_UINT32(0U, equal_calls);
+}
+
+// Test REPLACE overwrites the newest element in place
+TEST(queue_coalesce, GivenEquivalentNewestWhenReplaceThenNewestUpdatedInPlace)
+{
+    status_event_t ev = {1U, 10U};
+    bool coalesced = false;
+
+    queue_push_coalesce(&q, &ev, &replace_policy, NULL);
+    ev.value = 20U;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_coalesce(&q, &ev, &replace_policy, &coalesced));
+    TEST_ASSERT_TRUE(coalesced);
+    TEST_ASSERT_EQUAL_UINT32(1U, queue_count(&q));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &ev));
+    TEST_ASSERT_EQUAL_UINT8(20U, ev.value);
+}
+
+// Test DROP keeps the stored element and discards the new one
+TEST(queue_coalesce, GivenEquivalentNewestWhenDropThenNewItemDiscarded)
+{
+    status_event_t ev = {1U, 10U};
+    bool coalesced = false;
+
+    queue_push_coalesce(&q, &ev, &drop_policy, NULL);
+    ev.value = 20U;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_coalesce(&q, &ev, &drop_policy, &coalesced));
+    TEST_ASSERT_TRUE(coalesced);
+    TEST_ASSERT_EQUAL_UINT32(1U, queue_count(&q));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &ev));
+    TEST_ASSERT_EQUAL_UINT8(10U, ev.value);
+}
+
+// Test only the newest element is compared, so distinct events keep FIFO order
+TEST(queue_coalesce, GivenInterleavedEventsWhenPushCoalesceThenOnlyNewestCompared)
+{
+    status_event_t a = {1U, 1U};
+    status_event_t b = {2U, 2U};
+    status_event_t out = {0U, 0U};
+
+    queue_push_coalesce(&q, &a, &replace_policy, NULL);
+    queue_push_coalesce(&q, &b, &replace_policy, NULL);
+    a.value = 3U;
+    queue_push_coalesce(&q, &a, &replace_policy, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3U, queue_count(&q));
+
+    queue_pop(&q, &out);
+    TEST_ASSERT_EQUAL_UINT8(1U, out.id);
+    queue_pop(&q, &out);
+    TEST_ASSERT_EQUAL_UINT8(2U, out.id);
+    queue_pop(&q, &out);
+    TEST_ASSERT_EQUAL_UINT8(3U, out.value);
+}
+
+// Test coalescing across the wrap point compares the element in the last slot
+TEST(queue_coalesce, GivenTailAtSlotZeroWhenPushCoalesceThenLastSlotIsNewest)
+{
+    status_event_t ev = {0U, 0U};
+    bool coalesced = false;
+
+    for (uint8_t i = 1U; i <= QUEUE_CAPACITY; i++)
+    {
+        ev.id = i;
+        queue_push(&q, &ev);
+    }
+    queue_pop(&q, &ev);
+    TEST_ASSERT_EQUAL_UINT32(0U, q.tail);
+
+    ev.id = QUEUE_CAPACITY;
+    ev.value = 42U;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_coalesce(&q, &ev, &replace_policy, &coalesced));
+    TEST_ASSERT_TRUE(coalesced);
+    TEST_ASSERT_EQUAL_UINT8(42U, buffer[QUEUE_CAPACITY - 1].value);
+}
+
+// Test a full queue still accepts an equivalent update but rejects a distinct one
+TEST(queue_coalesce, GivenFullQueueWhenPushCoalesceThenOnlyEquivalentItemAccepted)
+{
+    status_event_t ev = {0U, 0U};
+    bool coalesced = true;
+
+    for (uint8_t i = 1U; i <= QUEUE_CAPACITY; i++)
+    {
+        ev.id = i;
+        queue_push(&q, &ev);
+    }
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_coalesce(&q, &ev, &replace_policy, &coalesced));
+    TEST_ASSERT_TRUE(coalesced);
+
+    ev.id = 9U;
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_push_coalesce(&q, &ev, &replace_policy, &coalesced));
+    TEST_ASSERT_FALSE(coalesced);
+}
+
+// Test coalesced items are counted separately from pushes
+TEST(queue_coalesce, GivenCoalescedPushesThenStatsCountThemSeparately)
+{
+    status_event_t ev = {1U, 0U};
+    queue_stats_t stats;
+
+    queue_push_coalesce(&q, &ev, &replace_policy, NULL);
+    queue_push_coalesce(&q, &ev, &replace_policy, NULL);
+    queue_push_coalesce(&q, &ev, &drop_policy, NULL);
+
+    queue_get_stats(&q, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.coalesced);
+    queue_reset_stats(&q);
+    queue_get_stats(&q, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.coalesced);
+}
+
+// Test invalid parameters are rejected
+TEST(queue_coalesce, GivenNullParamsWhenPushCoalesceThenReturnsError)
+{
+    status_event_t ev = {1U, 0U};
+    const queue_coalesce_t no_compare = {NULL, QUEUE_COALESCE_REPLACE};
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_coalesce(NULL, &ev, &replace_policy, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_coalesce(&q, NULL, &replace_policy, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_coalesce(&q, &ev, NULL, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_coalesce(&q, &ev, &no_compare, NULL));
+    TEST_ASSERT_EQUAL_UINT32(0U, queue_count(&q));
+}
\ No newline at end of file
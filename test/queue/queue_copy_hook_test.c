@@ -0,0 +1,225 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+#include "queue_search.h"
+#include "queue_snapshot.h"
+#include <string.h> /* for memcpy */
+
+#define QUEUE_CAPACITY 5
+#define MAX_CALLS      8
+
+typedef struct
+{
+    uint32_t calls;
+    uint32_t sizes[MAX_CALLS];
+} hook_log_t;
+
+typedef struct
+{
+    hook_log_t in;
+    hook_log_t out;
+} hook_ctx_t;
+
+static queue_t q;
+static uint32_t buffer[QUEUE_CAPACITY];
+static hook_ctx_t ctx;
+static uint8_t record[128];
+static uint32_t record_used;
+
+static void log_call(hook_log_t *log, uint32_t size)
+{
+    if (log->calls < MAX_CALLS)
+    {
+        log->sizes[log->calls] = size;
+    }
+    log->calls++;
+}
+
+/* Byte loop standing in for a DMA or cache-maintaining copy; keeps the bytes unchanged */
+static void hook_copy(void *dst, const void *src, uint32_t size)
+{
+    uint8_t *d = (uint8_t *)dst;
+    const uint8_t *s = (const uint8_t *)src;
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        d[i] = s[i];
+    }
+}
+
+static void hook_in(void *user, void *dst, const void *src, uint32_t size)
+{
+    log_call(&((hook_ctx_t *)user)->in, size);
+    hook_copy(dst, src, size);
+}
+
+static void hook_out(void *user, void *dst, const void *src, uint32_t size)
+{
+    log_call(&((hook_ctx_t *)user)->out, size);
+    hook_copy(dst, src, size);
+}
+
+static bool record_write(void *user, const void *data, uint32_t size)
+{
+    bool ok = (record_used + size) <= sizeof(record);
+
+    (void)user;
+    if (ok)
+    {
+        memcpy(&record[record_used], data, size);
+        record_used += size;
+    }
+
+    return ok;
+}
+
+static const queue_init_config_t hooked = {sizeof(uint32_t), QUEUE_CAPACITY, {hook_in, hook_out, &ctx}};
+
+TEST_GROUP(queue_copy_hook);
+
+TEST_SETUP(queue_copy_hook)
+{
+    hook_ctx_t clear = {{0U, {0U}}, {0U, {0U}}};
+
+    ctx = clear;
+    record_used = 0U;
+    queue_init_ex(&q, buffer, &hooked);
+}
+
+TEST_TEAR_DOWN(queue_copy_hook)
+{
+}
+
+// Test invalid extended init arguments are rejected
+TEST(queue_copy_hook, GivenInvalidArgsWhenInitExThenReturnsError)
+{
+    queue_t other;
+    const queue_init_config_t no_size = {0U, QUEUE_CAPACITY, {hook_in, hook_out, &ctx}};
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_ex(NULL, buffer, &hooked));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_ex(&other, NULL, &hooked));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_ex(&other, buffer, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_ex(&other, buffer, &no_size));
+}
+
+// Test push stores through copy-in and pop reads through copy-out
+TEST(queue_copy_hook, GivenHookedQueueWhenPushPopThenHooksMoveData)
+{
+    uint32_t value = 0x12345678U;
+    uint32_t out = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+    TEST_ASSERT_EQUAL_HEX32(0x12345678U, buffer[0]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+    TEST_ASSERT_EQUAL_HEX32(0x12345678U, out);
+    TEST_ASSERT_EQUAL_UINT32(1U, ctx.in.calls);
+    TEST_ASSERT_EQUAL_UINT32(1U, ctx.out.calls);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(uint32_t), ctx.in.sizes[0]);
+}
+
+// Test peek variants read through copy-out
+TEST(queue_copy_hook, GivenHookedQueueWhenPeekThenCopyOutUsed)
+{
+    uint32_t values[2] = {7U, 9U};
+    uint32_t out = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &values[0]));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_overwrite(&q, &values[1], NULL));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_peek(&q, &out));
+    TEST_ASSERT_EQUAL_UINT32(7U, out);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_peek_at(&q, 1U, &out));
+    TEST_ASSERT_EQUAL_UINT32(9U, out);
+    TEST_ASSERT_EQUAL_UINT32(2U, ctx.in.calls);
+    TEST_ASSERT_EQUAL_UINT32(2U, ctx.out.calls);
+}
+
+// Test a wrapped block is passed as two non-empty segments, an unwrapped one as one
+TEST(queue_copy_hook, GivenWrappedBlockWhenPushNThenHookCalledPerSegment)
+{
+    const uint32_t in[4] = {1U, 2U, 3U, 4U};
+    uint32_t out[4] = {0U, 0U, 0U, 0U};
+    queue_index_t moved = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, 3U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&q, out, 3U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_all(&q, in, 4U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_exact(&q, out, 4U));
+
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(in, out, 4);
+    TEST_ASSERT_EQUAL_UINT32(3U, ctx.in.calls);
+    TEST_ASSERT_EQUAL_UINT32(3U * sizeof(uint32_t), ctx.in.sizes[0]);
+    TEST_ASSERT_EQUAL_UINT32(2U * sizeof(uint32_t), ctx.in.sizes[1]);
+    TEST_ASSERT_EQUAL_UINT32(2U * sizeof(uint32_t), ctx.in.sizes[2]);
+    TEST_ASSERT_EQUAL_UINT32(3U, ctx.out.calls);
+}
+
+// Test a NULL hook falls back to the copy engine for that direction only
+TEST(queue_copy_hook, GivenOnlyCopyInHookWhenPopThenCopyEngineUsed)
+{
+    const queue_init_config_t in_only = {sizeof(uint32_t), QUEUE_CAPACITY, {hook_in, NULL, &ctx}};
+    uint32_t value = 0x0000FFFFU;
+    uint32_t out = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init_ex(&q, buffer, &in_only));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+    TEST_ASSERT_EQUAL_HEX32(0x0000FFFFU, out);
+    TEST_ASSERT_EQUAL_UINT32(1U, ctx.in.calls);
+    TEST_ASSERT_EQUAL_UINT32(0U, ctx.out.calls);
+}
+
+// Test plain queue_init() installs the copy engine in both directions
+TEST(queue_copy_hook, GivenHookedQueueWhenReinitWithQueueInitThenHooksRemoved)
+{
+    uint32_t value = 42U;
+    uint32_t out = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init(&q, buffer, sizeof(uint32_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+    TEST_ASSERT_EQUAL_UINT32(42U, buffer[0]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+    TEST_ASSERT_EQUAL_UINT32(42U, out);
+    TEST_ASSERT_EQUAL_UINT32(0U, ctx.in.calls + ctx.out.calls);
+}
+
+// Test remove_if matches keys in the storage and moves the kept elements through copy-in
+TEST(queue_copy_hook, GivenHookedQueueWhenRemoveIfThenKeptElementsMovedThroughCopyIn)
+{
+    static const queue_search_key_t word_key = {0U, 4U};
+    const uint32_t in[QUEUE_CAPACITY] = {1U, 2U, 3U, 2U, 4U};
+    const uint32_t expected[3] = {1U, 3U, 4U};
+    uint32_t out[3] = {0U, 0U, 0U};
+    queue_index_t removed = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_all(&q, in, QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_remove_if(&q, &word_key, 2U, &removed));
+
+    TEST_ASSERT_EQUAL_UINT16(2U, removed);
+    TEST_ASSERT_EQUAL_UINT32(3U, ctx.in.calls);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(uint32_t), ctx.in.sizes[1]);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(uint32_t), ctx.in.sizes[2]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_exact(&q, out, 3U));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, out, 3);
+    TEST_ASSERT_EQUAL_UINT32(1U, ctx.out.calls);
+}
+
+// Test a snapshot of a hooked queue restores into a hooked queue unchanged
+TEST(queue_copy_hook, GivenHookedQueuesWhenSnapshotRestoredThenContentsUnchanged)
+{
+    static const queue_snapshot_sink_t sink = {record_write, NULL};
+    const uint32_t in[3] = {0x11223344U, 0x55667788U, 0x99AABBCCU};
+    uint32_t other_buffer[QUEUE_CAPACITY];
+    uint32_t out[3] = {0U, 0U, 0U};
+    queue_snapshot_t snap;
+    queue_t other;
+    uint32_t written = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_all(&q, in, 3U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_init(&snap, &q, &sink));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_full(&snap, &written));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init_ex(&other, other_buffer, &hooked));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_restore(&other, record, record_used, NULL));
+
+    TEST_ASSERT_EQUAL_UINT32(2U, ctx.in.calls);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_exact(&other, out, 3U));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(in, out, 3);
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define COPY_TEST_MAX_SIZE 64U
+#define COPY_TEST_GUARD    0xA5U
+
+/* Word arrays guarantee word aligned byte buffers for the aligned paths. */
+static uint32_t src_words[(COPY_TEST_MAX_SIZE / 4U) + 2U];
+static uint32_t dst_words[(COPY_TEST_MAX_SIZE / 4U) + 2U];
+
+extern void copy_bytes(uint8_t *dst, const uint8_t *src, uint32_t size);
+
+static void fill_pattern(uint8_t *buf, uint32_t size, uint8_t seed)
+{
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        buf[i] = (uint8_t)(seed + (uint8_t)i);
+    }
+}
+
+static void fill_guard(uint8_t *buf, uint32_t size)
+{
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        buf[i] = COPY_TEST_GUARD;
+    }
+}
+
+/* Copies `size` bytes with the given offsets and checks content and guard bytes. */
+static void check_copy(uint32_t size, uint32_t dst_offset, uint32_t src_offset)
+{
+    uint8_t *src = (uint8_t *)src_words;
+    uint8_t *dst = (uint8_t *)dst_words;
+
+    fill_pattern(src, sizeof(src_words), 1U);
+    fill_guard(dst, sizeof(dst_words));
+
+    copy_bytes(&dst[dst_offset], &src[src_offset], size);
+
+    TEST_ASSERT_EQUAL_MEMORY(&src[src_offset], &dst[dst_offset], size);
+    for (uint32_t i = 0U; i < dst_offset; i++)
+    {
+        TEST_ASSERT_EQUAL_HEX8(COPY_TEST_GUARD, dst[i]);
+    }
+    TEST_ASSERT_EQUAL_HEX8(COPY_TEST_GUARD, dst[dst_offset + size]);
+}
+
+TEST_GROUP(queue_copy);
+
+TEST_SETUP(queue_copy)
+{
+}
+
+TEST_TEAR_DOWN(queue_copy)
+{
+}
+
+TEST(queue_copy, GivenAlignedBuffersWhenCopyFastPathSizesThenDataMatches)
+{
+    const uint32_t sizes[] = {1U, 2U, 4U, 8U, 16U};
+
+    for (uint32_t i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        check_copy(sizes[i], 0U, 0U);
+    }
+}
+
+TEST(queue_copy, GivenAlignedBuffersWhenCopyOddSizesThenWordLoopAndTailMatch)
+{
+    for (uint32_t size = 3U; size <= COPY_TEST_MAX_SIZE; size++)
+    {
+        check_copy(size, 0U, 0U);
+    }
+}
+
+TEST(queue_copy, GivenUnalignedSourceWhenCopyThenDataMatches)
+{
+    for (uint32_t size = 1U; size <= 17U; size++)
+    {
+        check_copy(size, 0U, 1U);
+    }
+}
+
+TEST(queue_copy, GivenUnalignedDestinationWhenCopyThenDataMatchesAndGuardsIntact)
+{
+    for (uint32_t size = 1U; size <= 17U; size++)
+    {
+        check_copy(size, 3U, 0U);
+    }
+}
+
+TEST(queue_copy, GivenHalfWordAlignedBuffersWhenCopyTwoBytesThenDataMatches)
+{
+    check_copy(2U, 2U, 2U);
+    check_copy(2U, 1U, 2U);
+}
+
+TEST(queue_copy, GivenZeroSizeWhenCopyThenDestinationUnchanged)
+{
+    uint8_t *src = (uint8_t *)src_words;
+    uint8_t *dst = (uint8_t *)dst_words;
+
+    fill_pattern(src, sizeof(src_words), 1U);
+    fill_guard(dst, sizeof(dst_words));
+
+    copy_bytes(dst, src, 0U);
+
+    for (uint32_t i = 0U; i < sizeof(dst_words); i++)
+    {
+        TEST_ASSERT_EQUAL_HEX8(COPY_TEST_GUARD, dst[i]);
+    }
+}
+
+TEST(queue_copy, Given16ByteElementsWhenPushPopWithWrapThenDataMatches)
+{
+    typedef struct
+    {
+        uint32_t w[4];
+    } elem16_t;
+
+    elem16_t buffer[3];
+    elem16_t in;
+    elem16_t out;
+    queue_t q16;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init(&q16, buffer, sizeof(elem16_t), 3U));
+
+    for (uint32_t i = 0U; i < 7U; i++)
+    {
+        in.w[0] = i;
+        in.w[1] = i + 100U;
+        in.w[2] = i + 200U;
+        in.w[3] = i + 300U;
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q16, &in));
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q16, &out));
+        TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(elem16_t));
+    }
+}
+
+TEST(queue_copy, Given32ByteLogEntriesWhenPushPeekPopThenDataMatches)
+{
+    typedef struct
+    {
+        uint8_t data[32];
+    } log_entry_t;
+
+    log_entry_t buffer[2];
+    log_entry_t in;
+    log_entry_t out;
+    queue_t log_q;
+
+    fill_pattern(in.data, sizeof(in.data), 7U);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init(&log_q, buffer, sizeof(log_entry_t), 2U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&log_q, &in));
+
+    fill_guard(out.data, sizeof(out.data));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_peek(&log_q, &out));
+    TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(log_entry_t));
+
+    fill_guard(out.data, sizeof(out.data));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&log_q, &out));
+    TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(log_entry_t));
+}
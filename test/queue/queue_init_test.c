@@ -92,3 +92,11 @@ TEST(queue_init, GivenMaxElementSizeAndCapacityThenInitSucceeds)
     TEST_ASSERT_EQUAL_UINT16(65535U, big_queue.capacity);
     TEST_ASSERT_TRUE(queue_is_empty(&big_queue));
 }
+
+#if (QUEUE_CFG_INDEX_BITS == 32)
+TEST(queue_init, GivenBufferAbove4GiBWhenInitThenReturnsError)
+{
+    queue_status_t status = queue_init(&q, test_buffer, 0x10000U, 0x10000U);
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, status);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define QUEUE_CAPACITY 4U
+
+static queue_t q;
+static uint32_t buffer[QUEUE_CAPACITY];
+static queue_iter_t it;
+
+/* Leaves the queue holding 10, 11, 12 with head = 2, so the data wraps */
+static void fill_wrapped(void)
+{
+    uint32_t value = 0U;
+
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        queue_push(&q, &value);
+        queue_pop(&q, &value);
+    }
+    for (uint32_t i = 10U; i < 13U; i++)
+    {
+        queue_push(&q, &i);
+    }
+}
+
+TEST_GROUP(queue_iter);
+
+TEST_SETUP(queue_iter)
+{
+    queue_init(&q, buffer, sizeof(uint32_t), QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_iter)
+{
+}
+
+TEST(queue_iter, GivenWrappedQueueWhenPeekAtEachOffsetThenReturnsElementsInFifoOrder)
+{
+    uint32_t value = 0U;
+
+    fill_wrapped();
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_peek_at(&q, (queue_index_t)i, &value));
+        TEST_ASSERT_EQUAL_UINT32(10U + i, value);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3U, queue_count(&q));
+    TEST_ASSERT_EQUAL_UINT32(2U, q.head);
+}
+
+TEST(queue_iter, GivenOffsetNotBelowCountWhenPeekAtThenReturnsEmptyAndItemUnchanged)
+{
+    uint32_t value = 0xA5A5A5A5U;
+
+    fill_wrapped();
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_peek_at(&q, 3U, &value));
+    TEST_ASSERT_EQUAL_UINT32(0xA5A5A5A5U, value);
+}
+
+TEST(queue_iter, GivenNullParamsWhenPeekAtThenReturnsError)
+{
+    uint32_t value = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_peek_at(NULL, 0U, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_peek_at(&q, 0U, NULL));
+}
+
+TEST(queue_iter, GivenWrappedQueueWhenIteratingThenPointersFollowRingWithoutCopying)
+{
+    const void *element = NULL;
+
+    fill_wrapped();
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_iter_init(&it, &q));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_iter_next(&it, &element));
+    TEST_ASSERT_EQUAL_PTR(&buffer[2], element);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_iter_next(&it, &element));
+    TEST_ASSERT_EQUAL_PTR(&buffer[3], element);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_iter_next(&it, &element));
+    TEST_ASSERT_EQUAL_PTR(&buffer[0], element);
+    TEST_ASSERT_EQUAL_UINT32(12U, *(const uint32_t *)element);
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_iter_next(&it, &element));
+    TEST_ASSERT_EQUAL_PTR(&buffer[0], element);
+    TEST_ASSERT_EQUAL_UINT32(3U, queue_count(&q));
+}
+
+TEST(queue_iter, GivenEmptyQueueWhenIteratingThenFirstNextReturnsEmpty)
+{
+    const void *element = NULL;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_iter_init(&it, &q));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_iter_next(&it, &element));
+    TEST_ASSERT_NULL(element);
+}
+
+TEST(queue_iter, GivenPushDuringScanWhenIteratingThenOnlyInitialElementsVisited)
+{
+    const void *element = NULL;
+    uint32_t value = 99U;
+    uint32_t visited = 0U;
+
+    fill_wrapped();
+    queue_iter_init(&it, &q);
+    queue_push(&q, &value);
+    while (queue_iter_next(&it, &element) == QUEUE_OK)
+    {
+        visited++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(3U, visited);
+}
+
+TEST(queue_iter, GivenNullParamsWhenIterThenReturnsError)
+{
+    const void *element = NULL;
+    queue_iter_t unset = {NULL, 0U, 0U};
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_iter_init(NULL, &q));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_iter_init(&it, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_iter_next(NULL, &element));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_iter_next(&unset, &element));
+    queue_iter_init(&it, &q);
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_iter_next(&it, NULL));
+}
\ No newline at end of file
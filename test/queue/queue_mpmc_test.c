@@ -0,0 +1,128 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_mpmc.h"
+
+#define QUEUE_CAPACITY 4U
+
+static queue_mpmc_t q;
+static uint32_t buffer[QUEUE_CAPACITY];
+static queue_mpmc_atomic_t seq[QUEUE_CAPACITY];
+static const queue_mpmc_storage_t storage = {buffer, seq};
+
+TEST_GROUP(queue_mpmc);
+
+TEST_SETUP(queue_mpmc)
+{
+    queue_mpmc_init(&q, &storage, sizeof(uint32_t), QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_mpmc)
+{
+}
+
+// Test init accepts power-of-two capacities >= 2 only
+TEST(queue_mpmc, GivenInvalidArgsWhenInitThenReturnsError)
+{
+    queue_mpmc_t other;
+    const queue_mpmc_storage_t no_buffer = {NULL, seq};
+    const queue_mpmc_storage_t no_seq = {buffer, NULL};
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_init(NULL, &storage, sizeof(uint32_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_init(&other, NULL, sizeof(uint32_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_init(&other, &no_buffer, sizeof(uint32_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_init(&other, &no_seq, sizeof(uint32_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_init(&other, &storage, 0U, QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_init(&other, &storage, sizeof(uint32_t), 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_init(&other, &storage, sizeof(uint32_t), 3U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_init(&other, &storage, sizeof(uint32_t), 2U));
+}
+
+// Test new queue is empty and pop leaves item unchanged
+TEST(queue_mpmc, GivenNewQueueWhenPopThenReturnsEmpty)
+{
+    uint32_t out = 5U;
+
+    TEST_ASSERT_TRUE(queue_mpmc_is_empty(&q));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_mpmc_pop(&q, &out));
+    TEST_ASSERT_EQUAL_UINT32(5U, out);
+}
+
+// Test the full capacity is usable and one more push is rejected
+TEST(queue_mpmc, GivenFullQueueWhenPushThenReturnsFull)
+{
+    uint32_t value = 1U;
+
+    for (uint32_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_push(&q, &value));
+    }
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_mpmc_push(&q, &value));
+    TEST_ASSERT_FALSE(queue_mpmc_is_empty(&q));
+}
+
+// Test FIFO order across many wrap-arounds of the slot index
+TEST(queue_mpmc, GivenManyWrapAroundsWhenPushPopThenFifoOrderPreserved)
+{
+    uint32_t out = 0U;
+
+    for (uint32_t i = 0U; i < (5U * QUEUE_CAPACITY); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_push(&q, &i));
+        if ((i % 2U) == 1U)
+        {
+            TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_pop(&q, &out));
+            TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_pop(&q, &out));
+            TEST_ASSERT_EQUAL_UINT32(i, out);
+        }
+    }
+    TEST_ASSERT_TRUE(queue_mpmc_is_empty(&q));
+}
+
+// Test sequence numbers mark slots as free / full for the owning side
+TEST(queue_mpmc, GivenPushAndPopThenSlotSequenceAdvancesByCapacity)
+{
+    uint32_t value = 9U;
+
+    TEST_ASSERT_EQUAL_UINT32(0U, seq[0]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_push(&q, &value));
+    TEST_ASSERT_EQUAL_UINT32(1U, seq[0]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_pop(&q, &value));
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_CAPACITY, seq[0]);
+}
+
+// Test indices keep working when they wrap at 2^32
+TEST(queue_mpmc, GivenIndicesNearWrapWhenPushPopThenFifoOrderPreserved)
+{
+    const uint32_t start = 0xFFFFFFFEU;
+    uint32_t out = 0U;
+
+    q.head = start;
+    q.tail = start;
+    for (uint32_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        seq[(start + i) & (QUEUE_CAPACITY - 1U)] = start + i;
+    }
+
+    for (uint32_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_push(&q, &i));
+    }
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_mpmc_push(&q, &out));
+    for (uint32_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_pop(&q, &out));
+        TEST_ASSERT_EQUAL_UINT32(i, out);
+    }
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_mpmc_pop(&q, &out));
+}
+
+// Test NULL parameters are rejected
+TEST(queue_mpmc, GivenNullParamsThenReturnsError)
+{
+    uint32_t value = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_push(NULL, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_push(&q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_pop(NULL, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_pop(&q, NULL));
+    TEST_ASSERT_TRUE(queue_mpmc_is_empty(NULL));
+}
\ No newline at end of file
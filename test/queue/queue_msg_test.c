@@ -0,0 +1,153 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_msg.h"
+#include <string.h>
+
+#define MSG_BUFFER_SIZE 16U
+
+static queue_msg_t q;
+static uint8_t buffer[MSG_BUFFER_SIZE];
+
+TEST_GROUP(queue_msg);
+
+TEST_SETUP(queue_msg)
+{
+    memset(buffer, 0, sizeof(buffer));
+    queue_msg_init(&q, buffer, MSG_BUFFER_SIZE);
+}
+
+TEST_TEAR_DOWN(queue_msg)
+{
+}
+
+// Test init rejects NULL and buffers too small for a single prefix
+TEST(queue_msg, GivenInvalidArgsWhenInitThenReturnsError)
+{
+    queue_msg_t other;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_init(NULL, buffer, MSG_BUFFER_SIZE));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_init(&other, NULL, MSG_BUFFER_SIZE));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_init(&other, buffer, QUEUE_MSG_HEADER_SIZE));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_init(&other, buffer, QUEUE_MSG_HEADER_SIZE + 1U));
+}
+
+// Test new queue is empty and offers the whole buffer minus one prefix
+TEST(queue_msg, GivenNewQueueThenEmptyAndFreeSpaceIsBufferMinusHeader)
+{
+    uint16_t len = 7U;
+
+    TEST_ASSERT_TRUE(queue_msg_is_empty(&q));
+    TEST_ASSERT_EQUAL_UINT16(MSG_BUFFER_SIZE - QUEUE_MSG_HEADER_SIZE, queue_msg_free_space(&q));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_msg_peek_len(&q, &len));
+    TEST_ASSERT_EQUAL_UINT16(7U, len);
+}
+
+// Test records of different lengths come back in order with their own length
+TEST(queue_msg, GivenRecordsOfDifferentLengthWhenPopThenOrderAndLengthPreserved)
+{
+    const char *msgs[] = {"a", "boot", "ok!"};
+    char out[8] = {0};
+    uint16_t len = 0U;
+
+    for (int i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, msgs[i], (uint16_t)strlen(msgs[i])));
+    }
+    TEST_ASSERT_EQUAL_UINT16(3U, q.count);
+    TEST_ASSERT_EQUAL_UINT16(8U + (3U * QUEUE_MSG_HEADER_SIZE), q.used);
+
+    for (int i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_peek_len(&q, &len));
+        TEST_ASSERT_EQUAL_UINT16(strlen(msgs[i]), len);
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_pop(&q, out, sizeof(out), &len));
+        TEST_ASSERT_EQUAL_MEMORY(msgs[i], out, len);
+    }
+    TEST_ASSERT_TRUE(queue_msg_is_empty(&q));
+}
+
+// Test a record that does not fit is rejected and the queue is unchanged
+TEST(queue_msg, GivenInsufficientSpaceWhenPushThenReturnsFull)
+{
+    const uint8_t data[MSG_BUFFER_SIZE] = {0};
+
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_msg_push(&q, data, MSG_BUFFER_SIZE - 1U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, data, MSG_BUFFER_SIZE - QUEUE_MSG_HEADER_SIZE));
+    TEST_ASSERT_EQUAL_UINT16(0U, queue_msg_free_space(&q));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_msg_push(&q, data, 0U));
+    TEST_ASSERT_EQUAL_UINT16(1U, q.count);
+}
+
+// Test records split across the buffer end are reassembled without padding
+TEST(queue_msg, GivenRecordsCrossingBufferEndWhenPopThenPayloadIntact)
+{
+    const uint8_t first[9] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U};
+    const uint8_t second[10] = {10U, 11U, 12U, 13U, 14U, 15U, 16U, 17U, 18U, 19U};
+    uint8_t out[10] = {0U};
+    uint16_t len = 0U;
+
+    /* first record: offsets 0..10, tail = 11 */
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, first, sizeof(first)));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_pop(&q, out, sizeof(out), &len));
+
+    /* second record: prefix at 11..12, payload 13..15 + 0..6 */
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, second, sizeof(second)));
+    TEST_ASSERT_EQUAL_UINT16(7U, q.tail);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_pop(&q, out, sizeof(out), &len));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(second), len);
+    TEST_ASSERT_EQUAL_MEMORY(second, out, sizeof(second));
+
+    /* third record: move head/tail to 15, so the prefix spans 15 and 0 */
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, first, 6U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_pop(&q, out, sizeof(out), &len));
+    TEST_ASSERT_EQUAL_UINT16(15U, q.head);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, second, 3U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_peek_len(&q, &len));
+    TEST_ASSERT_EQUAL_UINT16(3U, len);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_pop(&q, out, sizeof(out), &len));
+    TEST_ASSERT_EQUAL_MEMORY(second, out, 3U);
+    TEST_ASSERT_EQUAL_UINT16(0U, q.used);
+}
+
+// Test too small destination keeps the record and reports its length
+TEST(queue_msg, GivenTooSmallDestinationWhenPopThenErrorAndRecordKept)
+{
+    const uint8_t data[5] = {1U, 2U, 3U, 4U, 5U};
+    uint8_t out[4] = {0U};
+    uint16_t len = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, data, sizeof(data)));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_pop(&q, out, sizeof(out), &len));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(data), len);
+    TEST_ASSERT_EQUAL_UINT16(1U, q.count);
+}
+
+// Test zero-length records are stored as a bare prefix
+TEST(queue_msg, GivenZeroLengthRecordWhenPushPopThenLengthZero)
+{
+    uint8_t dummy = 0xAAU;
+    uint16_t len = 9U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, &dummy, 0U));
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_MSG_HEADER_SIZE, q.used);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_pop(&q, &dummy, 0U, &len));
+    TEST_ASSERT_EQUAL_UINT16(0U, len);
+    TEST_ASSERT_EQUAL_HEX8(0xAAU, dummy);
+}
+
+// Test NULL parameters are rejected
+TEST(queue_msg, GivenNullParamsThenReturnsErrorAndSafeValues)
+{
+    uint8_t data = 1U;
+    uint16_t len = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_push(NULL, &data, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_push(&q, NULL, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_peek_len(NULL, &len));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_peek_len(&q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_msg_push(&q, &data, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_pop(NULL, &data, 1U, &len));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_pop(&q, NULL, 1U, &len));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_msg_pop(&q, &data, 1U, NULL));
+    TEST_ASSERT_TRUE(queue_msg_is_empty(NULL));
+    TEST_ASSERT_EQUAL_UINT16(0U, queue_msg_free_space(NULL));
+}
\ No newline at end of file
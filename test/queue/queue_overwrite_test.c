@@ -0,0 +1,97 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define QUEUE_CAPACITY 3
+
+static queue_t q;
+static int buffer[QUEUE_CAPACITY];
+
+TEST_GROUP(queue_overwrite);
+
+TEST_SETUP(queue_overwrite)
+{
+    queue_init(&q, buffer, sizeof(int), QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_overwrite)
+{
+}
+
+// Test overwrite push on a non-full queue behaves like queue_push
+TEST(queue_overwrite, GivenNotFullQueueWhenPushOverwriteThenNoOverwriteReported)
+{
+    int value = 4;
+    bool overwritten = true;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_overwrite(&q, &value, &overwritten));
+    TEST_ASSERT_FALSE(overwritten);
+    TEST_ASSERT_EQUAL(1, q.count);
+}
+
+// Test overwrite push on a full queue drops the oldest element
+TEST(queue_overwrite, GivenFullQueueWhenPushOverwriteThenOldestDroppedAndReported)
+{
+    int in[QUEUE_CAPACITY + 1] = {1, 2, 3, 4};
+    int out = 0;
+    bool overwritten = false;
+
+    for (int i = 0; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &in[i]));
+    }
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_overwrite(&q, &in[QUEUE_CAPACITY], &overwritten));
+    TEST_ASSERT_TRUE(overwritten);
+    TEST_ASSERT_TRUE(queue_is_full(&q));
+
+    for (int i = 1; i <= QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+        TEST_ASSERT_EQUAL_INT(in[i], out);
+    }
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test continuous overload keeps the newest capacity elements
+TEST(queue_overwrite, GivenOverloadWhenPushOverwriteManyThenNewestElementsKept)
+{
+    int out = 0;
+    int losses = 0;
+    bool overwritten = false;
+
+    for (int i = 0; i < 10; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_overwrite(&q, &i, &overwritten));
+        losses += overwritten ? 1 : 0;
+    }
+
+    TEST_ASSERT_EQUAL_INT(10 - QUEUE_CAPACITY, losses);
+    for (int i = 10 - QUEUE_CAPACITY; i < 10; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+        TEST_ASSERT_EQUAL_INT(i, out);
+    }
+}
+
+// Test NULL overwrite flag is optional
+TEST(queue_overwrite, GivenNullOverwrittenFlagWhenPushOverwriteThenSucceeds)
+{
+    int value = 1;
+
+    for (int i = 0; i < (QUEUE_CAPACITY + 2); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_overwrite(&q, &value, NULL));
+    }
+    TEST_ASSERT_EQUAL(QUEUE_CAPACITY, q.count);
+}
+
+// Test NULL queue / item are rejected
+TEST(queue_overwrite, GivenNullParamsWhenPushOverwriteThenReturnsError)
+{
+    int value = 1;
+    bool overwritten = false;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_overwrite(NULL, &value, &overwritten));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_overwrite(&q, NULL, &overwritten));
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define POW2_CAPACITY 4
+
+static queue_t q;
+static int buffer[POW2_CAPACITY];
+
+TEST_GROUP(queue_pow2);
+
+TEST_SETUP(queue_pow2)
+{
+    queue_init_pow2(&q, buffer, sizeof(int), POW2_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_pow2)
+{
+}
+
+// Test power-of-two capacity sets the wrap mask
+TEST(queue_pow2, GivenPowerOfTwoCapacityWhenInitThenMaskIsSet)
+{
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init_pow2(&q, buffer, sizeof(int), POW2_CAPACITY));
+    TEST_ASSERT_EQUAL(POW2_CAPACITY - 1, q.index_mask);
+    TEST_ASSERT_EQUAL(POW2_CAPACITY, q.capacity);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test non power-of-two and invalid capacities are rejected
+TEST(queue_pow2, GivenNonPowerOfTwoCapacityWhenInitThenReturnsError)
+{
+    queue_t local;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_pow2(&local, buffer, sizeof(int), 3U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_pow2(&local, buffer, sizeof(int), 6U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_pow2(&local, buffer, sizeof(int), 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_pow2(NULL, buffer, sizeof(int), POW2_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_init_pow2(&local, NULL, sizeof(int), POW2_CAPACITY));
+}
+
+// Test capacity of one is a valid power of two
+TEST(queue_pow2, GivenCapacityOneWhenPushPopThenBehavesAsFifo)
+{
+    int value = 5;
+    int out = 0;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init_pow2(&q, buffer, sizeof(int), 1U));
+    for (int i = 0; i < 3; i++)
+    {
+        value = i;
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+        TEST_ASSERT_EQUAL(QUEUE_FULL, queue_push(&q, &value));
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+        TEST_ASSERT_EQUAL_INT(i, out);
+        TEST_ASSERT_EQUAL(0, q.head);
+    }
+}
+
+// Test masked wrap keeps FIFO order over several wraps
+TEST(queue_pow2, GivenMaskedQueueWhenWrapSeveralTimesThenOrderIsPreserved)
+{
+    int out = 0;
+
+    for (int i = 0; i < (3 * POW2_CAPACITY); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &i));
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+        TEST_ASSERT_EQUAL_INT(i, out);
+        TEST_ASSERT_TRUE(q.tail < POW2_CAPACITY);
+    }
+}
+
+// Test batch operations wrap with the mask
+TEST(queue_pow2, GivenMaskedQueueWhenBatchWrapsThenIndicesWrapCorrectly)
+{
+    int in[POW2_CAPACITY] = {1, 2, 3, 4};
+    int out[POW2_CAPACITY] = {0};
+    queue_index_t moved = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, 3U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&q, out, 3U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, POW2_CAPACITY, &moved));
+
+    TEST_ASSERT_EQUAL(3, q.tail);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&q, out, POW2_CAPACITY, &moved));
+    TEST_ASSERT_EQUAL_INT_ARRAY(in, out, POW2_CAPACITY);
+    TEST_ASSERT_EQUAL(3, q.head);
+}
+
+// Test plain init on a previously masked instance clears the mask
+TEST(queue_pow2, GivenMaskedQueueWhenReinitWithQueueInitThenMaskCleared)
+{
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init(&q, buffer, sizeof(int), 3U));
+    TEST_ASSERT_EQUAL(0, q.index_mask);
+}
+
+// Test non power-of-two queue wraps by conditional subtraction
+TEST(queue_pow2, GivenNonPowerOfTwoQueueWhenWrapThenIndexRestartsAtZero)
+{
+    int value = 1;
+    int out = 0;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_init(&q, buffer, sizeof(int), 3U));
+    for (int i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+    }
+    TEST_ASSERT_EQUAL(0, q.head);
+    TEST_ASSERT_EQUAL(0, q.tail);
+}
\ No newline at end of file
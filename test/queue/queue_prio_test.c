@@ -0,0 +1,153 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_prio.h"
+
+#define QUEUE_CAPACITY 8
+
+typedef struct
+{
+    uint16_t id;
+    uint8_t payload[3];
+} job_t;
+
+static queue_prio_t q;
+static job_t buffer[QUEUE_CAPACITY];
+static queue_prio_key_t keys[QUEUE_CAPACITY];
+static const queue_prio_storage_t storage = {buffer, keys};
+
+TEST_GROUP(queue_prio);
+
+TEST_SETUP(queue_prio)
+{
+    queue_prio_init(&q, &storage, sizeof(job_t), QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_prio)
+{
+}
+
+// Test init rejects NULL and zero arguments
+TEST(queue_prio, GivenInvalidArgsWhenInitThenReturnsError)
+{
+    queue_prio_t other;
+    const queue_prio_storage_t no_keys = {buffer, NULL};
+    const queue_prio_storage_t no_buffer = {NULL, keys};
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_init(NULL, &storage, sizeof(job_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_init(&other, NULL, sizeof(job_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_init(&other, &no_keys, sizeof(job_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_init(&other, &no_buffer, sizeof(job_t), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_init(&other, &storage, 0U, QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_init(&other, &storage, sizeof(job_t), 0U));
+}
+
+// Test new queue is empty and pop leaves item unchanged
+TEST(queue_prio, GivenNewQueueWhenPopThenReturnsEmpty)
+{
+    job_t out = {7U, {0U}};
+
+    TEST_ASSERT_TRUE(queue_prio_is_empty(&q));
+    TEST_ASSERT_FALSE(queue_prio_is_full(&q));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_prio_pop(&q, &out, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_prio_peek(&q, &out, NULL));
+    TEST_ASSERT_EQUAL_UINT16(7U, out.id);
+}
+
+// Test most urgent element is served first regardless of insertion order
+TEST(queue_prio, GivenMixedPrioritiesWhenPopThenAscendingPriorityOrder)
+{
+    const uint16_t prios[QUEUE_CAPACITY] = {5U, 1U, 7U, 3U, 0U, 6U, 2U, 4U};
+    job_t job = {0U, {0U}};
+    uint16_t prio = 0U;
+
+    for (uint16_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        job.id = prios[i];
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_push(&q, &job, prios[i]));
+    }
+    TEST_ASSERT_TRUE(queue_prio_is_full(&q));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_prio_push(&q, &job, 0U));
+
+    for (uint16_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_pop(&q, &job, &prio));
+        TEST_ASSERT_EQUAL_UINT16(i, prio);
+        TEST_ASSERT_EQUAL_UINT16(i, job.id);
+    }
+    TEST_ASSERT_TRUE(queue_prio_is_empty(&q));
+}
+
+// Test equal priorities keep FIFO order (QUEUE_CFG_PRIO_STABLE)
+TEST(queue_prio, GivenEqualPrioritiesWhenPopThenFifoOrderWithinPriority)
+{
+    job_t job = {0U, {0U}};
+    uint16_t prio = 0U;
+
+    for (uint16_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        job.id = i;
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_push(&q, &job, (uint16_t)(i & 1U)));
+    }
+
+    for (uint16_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        const uint16_t expected = (i < (QUEUE_CAPACITY / 2U)) ? (uint16_t)(2U * i) : (uint16_t)((2U * i) - QUEUE_CAPACITY + 1U);
+
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_pop(&q, &job, &prio));
+        TEST_ASSERT_EQUAL_UINT16(expected, job.id);
+    }
+}
+
+// Test interleaved push/pop keeps heap order over many operations
+TEST(queue_prio, GivenPseudoRandomTrafficWhenPopThenNeverLessUrgentThanRemaining)
+{
+    uint32_t lcg = 12345U;
+    job_t job = {0U, {0U}};
+    uint16_t prio = 0U;
+    uint16_t next = 0U;
+
+    for (uint32_t round = 0U; round < 200U; round++)
+    {
+        while (!queue_prio_is_full(&q))
+        {
+            lcg = (lcg * 1103515245U) + 12345U;
+            job.id = (uint16_t)((lcg >> 16U) & 0x3FU);
+            TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_push(&q, &job, job.id));
+        }
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_pop(&q, &job, &prio));
+        TEST_ASSERT_EQUAL_UINT16(prio, job.id);
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_peek(&q, &job, &next));
+        TEST_ASSERT_TRUE(prio <= next);
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_pop(&q, &job, &next));
+        TEST_ASSERT_TRUE(prio <= next);
+    }
+}
+
+// Test peek returns the most urgent element without removing it
+TEST(queue_prio, GivenElementsWhenPeekThenMostUrgentAndCountUnchanged)
+{
+    job_t in = {11U, {1U, 2U, 3U}};
+    job_t urgent = {22U, {4U, 5U, 6U}};
+    job_t out = {0U, {0U}};
+    uint16_t prio = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_push(&q, &in, 9U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_push(&q, &urgent, 2U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_prio_peek(&q, &out, &prio));
+    TEST_ASSERT_EQUAL_UINT16(2U, prio);
+    TEST_ASSERT_EQUAL_MEMORY(&urgent, &out, sizeof(job_t));
+    TEST_ASSERT_EQUAL_UINT16(2U, q.count);
+}
+
+// Test NULL parameters are rejected
+TEST(queue_prio, GivenNullParamsThenReturnsErrorAndSafeValues)
+{
+    job_t job = {0U, {0U}};
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_push(NULL, &job, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_push(&q, NULL, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_pop(NULL, &job, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_pop(&q, NULL, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_prio_peek(NULL, &job, NULL));
+    TEST_ASSERT_TRUE(queue_prio_is_empty(NULL));
+    TEST_ASSERT_FALSE(queue_prio_is_full(NULL));
+}
\ No newline at end of file
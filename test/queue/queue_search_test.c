@@ -0,0 +1,217 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_search.h"
+#include <stddef.h> /* for offsetof */
+
+#define PACKED_CAPACITY 40U
+#define RECORD_CAPACITY 5U
+
+typedef struct
+{
+    uint8_t type;
+    uint16_t id;
+    uint32_t data;
+} command_t;
+
+static queue_t q;
+static uint32_t packed_buffer[PACKED_CAPACITY];
+static command_t record_buffer[RECORD_CAPACITY];
+
+static const queue_search_key_t word_key = {0U, 4U};
+static const queue_search_key_t id_key = {(uint16_t)offsetof(command_t, id), 2U};
+
+/* 30 elements 100..129 stored from slot 20, so the data wraps after 20 elements */
+static void fill_packed_wrapped(void)
+{
+    uint32_t value = 0U;
+
+    queue_init(&q, packed_buffer, sizeof(uint32_t), PACKED_CAPACITY);
+    for (uint32_t i = 0U; i < 20U; i++)
+    {
+        queue_push(&q, &value);
+    }
+    (void)queue_read_advance(&q, 20U);
+    for (uint32_t i = 0U; i < 30U; i++)
+    {
+        value = 100U + i;
+        queue_push(&q, &value);
+    }
+}
+
+static void push_command(uint8_t type, uint16_t id)
+{
+    const command_t c = {type, id, (uint32_t)id * 10U};
+
+    queue_push(&q, &c);
+}
+
+TEST_GROUP(queue_search);
+
+TEST_SETUP(queue_search)
+{
+}
+
+TEST_TEAR_DOWN(queue_search)
+{
+}
+
+TEST(queue_search, GivenPackedWrappedQueueWhenFindThenOffsetFromHeadReturned)
+{
+    queue_index_t offset = 0U;
+
+    fill_packed_wrapped();
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_find(&q, &word_key, 100U, &offset));
+    TEST_ASSERT_EQUAL_UINT32(0U, offset);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_find(&q, &word_key, 117U, &offset));
+    TEST_ASSERT_EQUAL_UINT32(17U, offset);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_find(&q, &word_key, 125U, &offset));
+    TEST_ASSERT_EQUAL_UINT32(25U, offset);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_find(&q, &word_key, 129U, &offset));
+    TEST_ASSERT_EQUAL_UINT32(29U, offset);
+}
+
+TEST(queue_search, GivenNoMatchWhenFindThenReturnsEmptyAndOffsetUnchanged)
+{
+    queue_index_t offset = 77U;
+
+    fill_packed_wrapped();
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_find(&q, &word_key, 0U, &offset));
+    TEST_ASSERT_EQUAL_UINT32(77U, offset);
+}
+
+TEST(queue_search, GivenStaleDataOutsideStoredRangeWhenFindThenNotReported)
+{
+    queue_index_t offset = 0U;
+
+    fill_packed_wrapped();
+    packed_buffer[15] = 555U; /* free slot between tail and head */
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_find(&q, &word_key, 555U, &offset));
+}
+
+TEST(queue_search, GivenPackedDuplicatesWhenCountIfThenAllMatchesCounted)
+{
+    uint16_t halves[PACKED_CAPACITY];
+    const queue_search_key_t half_key = {0U, 2U};
+    queue_index_t matches = 0U;
+    uint16_t value = 0U;
+
+    queue_init(&q, halves, sizeof(uint16_t), PACKED_CAPACITY);
+    for (uint16_t i = 0U; i < 37U; i++)
+    {
+        value = ((i % 3U) == 0U) ? 0xABCDU : i;
+        queue_push(&q, &value);
+    }
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_count_if(&q, &half_key, 0xABCDU, &matches));
+    TEST_ASSERT_EQUAL_UINT32(13U, matches);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_count_if(&q, &half_key, 0x1234U, &matches));
+    TEST_ASSERT_EQUAL_UINT32(0U, matches);
+}
+
+TEST(queue_search, GivenByteKeysWhenFindAndCountThenValueTruncatedToWidth)
+{
+    uint8_t bytes[PACKED_CAPACITY];
+    const queue_search_key_t byte_key = {0U, 1U};
+    queue_index_t result = 0U;
+    uint8_t value = 0U;
+
+    queue_init(&q, bytes, 1U, PACKED_CAPACITY);
+    for (uint8_t i = 0U; i < 35U; i++)
+    {
+        value = (uint8_t)(i & 0x0FU);
+        queue_push(&q, &value);
+    }
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_find(&q, &byte_key, 0x10DU, &result));
+    TEST_ASSERT_EQUAL_UINT32(13U, result);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_count_if(&q, &byte_key, 2U, &result));
+    TEST_ASSERT_EQUAL_UINT32(3U, result);
+}
+
+TEST(queue_search, GivenStridedKeyWhenFindThenFieldAtOffsetCompared)
+{
+    queue_index_t offset = 0U;
+
+    queue_init(&q, record_buffer, sizeof(command_t), RECORD_CAPACITY);
+    push_command(1U, 10U);
+    push_command(2U, 20U);
+    push_command(1U, 30U);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_find(&q, &id_key, 30U, &offset));
+    TEST_ASSERT_EQUAL_UINT32(2U, offset);
+}
+
+TEST(queue_search, GivenMatchesWhenRemoveIfThenSurvivorsKeepFifoOrder)
+{
+    command_t out;
+    queue_index_t removed = 0U;
+
+    queue_init(&q, record_buffer, sizeof(command_t), RECORD_CAPACITY);
+    push_command(9U, 0U);
+    queue_pop(&q, &out);
+    push_command(9U, 0U);
+    queue_pop(&q, &out); /* head = 2 so the data wraps */
+    push_command(1U, 7U);
+    push_command(2U, 8U);
+    push_command(3U, 7U);
+    push_command(4U, 9U);
+    push_command(5U, 7U);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_remove_if(&q, &id_key, 7U, &removed));
+    TEST_ASSERT_EQUAL_UINT32(3U, removed);
+    TEST_ASSERT_EQUAL_UINT32(2U, queue_count(&q));
+    TEST_ASSERT_EQUAL_UINT32(4U, q.tail);
+
+    queue_pop(&q, &out);
+    TEST_ASSERT_EQUAL_UINT8(2U, out.type);
+    queue_pop(&q, &out);
+    TEST_ASSERT_EQUAL_UINT8(4U, out.type);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+TEST(queue_search, GivenNoMatchWhenRemoveIfThenQueueUnchanged)
+{
+    queue_index_t removed = 5U;
+    queue_stats_t stats;
+
+    fill_packed_wrapped();
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_remove_if(&q, &word_key, 1U, &removed));
+    TEST_ASSERT_EQUAL_UINT32(0U, removed);
+    TEST_ASSERT_EQUAL_UINT32(30U, queue_count(&q));
+    TEST_ASSERT_EQUAL_UINT32(10U, q.tail);
+    queue_get_stats(&q, &stats);
+    TEST_ASSERT_EQUAL_UINT32(20U, stats.pops);
+}
+
+TEST(queue_search, GivenAllMatchWhenRemoveIfThenQueueEmptiedAtHead)
+{
+    uint32_t value = 3U;
+    queue_index_t removed = 0U;
+    queue_stats_t stats;
+
+    queue_init(&q, packed_buffer, sizeof(uint32_t), PACKED_CAPACITY);
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        queue_push(&q, &value);
+    }
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_remove_if(&q, &word_key, 3U, &removed));
+    TEST_ASSERT_EQUAL_UINT32(4U, removed);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+    TEST_ASSERT_EQUAL_UINT32(q.head, q.tail);
+    queue_get_stats(&q, &stats);
+    TEST_ASSERT_EQUAL_UINT32(4U, stats.pops);
+}
+
+TEST(queue_search, GivenInvalidParamsThenReturnsError)
+{
+    const queue_search_key_t bad_width = {0U, 3U};
+    const queue_search_key_t past_end = {(uint16_t)(sizeof(command_t) - 1U), 2U};
+    queue_index_t result = 0U;
+
+    queue_init(&q, record_buffer, sizeof(command_t), RECORD_CAPACITY);
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_find(NULL, &id_key, 0U, &result));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_find(&q, NULL, 0U, &result));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_find(&q, &id_key, 0U, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_find(&q, &bad_width, 0U, &result));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_find(&q, &past_end, 0U, &result));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_count_if(&q, &id_key, 0U, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_count_if(&q, &bad_width, 0U, &result));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_remove_if(&q, &id_key, 0U, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_remove_if(NULL, &id_key, 0U, &result));
+}
\ No newline at end of file
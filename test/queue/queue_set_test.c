@@ -0,0 +1,160 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_set.h"
+
+#define MEMBER_CAPACITY 2U
+
+static queue_t can_rx;
+static queue_t uart_rx;
+static queue_t log_q;
+static uint32_t can_buffer[MEMBER_CAPACITY];
+static uint32_t uart_buffer[MEMBER_CAPACITY];
+static uint32_t log_buffer[MEMBER_CAPACITY];
+static queue_t *const members[3] = {&can_rx, &uart_rx, &log_q};
+static queue_set_t set;
+
+TEST_GROUP(queue_set);
+
+TEST_SETUP(queue_set)
+{
+    queue_init(&can_rx, can_buffer, sizeof(uint32_t), MEMBER_CAPACITY);
+    queue_init(&uart_rx, uart_buffer, sizeof(uint32_t), MEMBER_CAPACITY);
+    queue_init(&log_q, log_buffer, sizeof(uint32_t), MEMBER_CAPACITY);
+    queue_set_init(&set, members, 3U);
+}
+
+TEST_TEAR_DOWN(queue_set)
+{
+}
+
+TEST(queue_set, GivenEmptyMembersWhenNextThenReturnsEmpty)
+{
+    uint8_t member = 7U;
+
+    TEST_ASSERT_EQUAL_HEX32(0U, set.ready);
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_set_next(&set, &member));
+    TEST_ASSERT_EQUAL_UINT8(7U, member);
+}
+
+TEST(queue_set, GivenPushToMemberThenItsReadyBitIsSet)
+{
+    uint32_t value = 1U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_push(&set, 2U, &value));
+    TEST_ASSERT_EQUAL_HEX32(0x20000000U, set.ready);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_push(&set, 0U, &value));
+    TEST_ASSERT_EQUAL_HEX32(0xA0000000U, set.ready);
+}
+
+TEST(queue_set, GivenSeveralReadyMembersWhenPopThenLowestIndexServedFirst)
+{
+    uint32_t value = 0U;
+    uint8_t member = 0U;
+
+    value = 30U;
+    queue_set_push(&set, 2U, &value);
+    value = 20U;
+    queue_set_push(&set, 1U, &value);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_pop(&set, &value, &member));
+    TEST_ASSERT_EQUAL_UINT8(1U, member);
+    TEST_ASSERT_EQUAL_UINT32(20U, value);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_pop(&set, &value, &member));
+    TEST_ASSERT_EQUAL_UINT8(2U, member);
+    TEST_ASSERT_EQUAL_UINT32(30U, value);
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_set_pop(&set, &value, &member));
+}
+
+TEST(queue_set, GivenMemberWithTwoElementsWhenPopThenBitClearedOnlyWhenDrained)
+{
+    uint32_t value = 5U;
+    uint8_t member = 0U;
+
+    queue_set_push(&set, 0U, &value);
+    queue_set_push(&set, 0U, &value);
+
+    queue_set_pop(&set, &value, &member);
+    TEST_ASSERT_EQUAL_HEX32(0x80000000U, set.ready);
+    queue_set_pop(&set, &value, &member);
+    TEST_ASSERT_EQUAL_HEX32(0U, set.ready);
+}
+
+TEST(queue_set, GivenFullMemberWhenPushThenReturnsFull)
+{
+    uint32_t value = 5U;
+
+    queue_set_push(&set, 1U, &value);
+    queue_set_push(&set, 1U, &value);
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_set_push(&set, 1U, &value));
+    TEST_ASSERT_EQUAL_HEX32(0x40000000U, set.ready);
+}
+
+TEST(queue_set, GivenNonEmptyMembersWhenInitThenReadyReflectsState)
+{
+    uint32_t value = 5U;
+
+    queue_push(&log_q, &value);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_init(&set, members, 3U));
+    TEST_ASSERT_EQUAL_HEX32(0x20000000U, set.ready);
+}
+
+TEST(queue_set, GivenDirectQueueCallsWhenSyncThenReadyBitFollowsMember)
+{
+    uint32_t value = 5U;
+    uint8_t member = 0U;
+
+    queue_push(&uart_rx, &value);
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_set_next(&set, &member));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_sync(&set, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_next(&set, &member));
+    TEST_ASSERT_EQUAL_UINT8(1U, member);
+
+    queue_pop(&uart_rx, &value);
+    queue_set_sync(&set, 1U);
+    TEST_ASSERT_EQUAL_HEX32(0U, set.ready);
+}
+
+TEST(queue_set, GivenThirtyTwoMembersWhenOnlyLastReadyThenNextSelectsIt)
+{
+    static queue_t queues[QUEUE_SET_MAX_MEMBERS];
+    static uint32_t storage[QUEUE_SET_MAX_MEMBERS];
+    static queue_t *list[QUEUE_SET_MAX_MEMBERS];
+    queue_set_t big;
+    uint32_t value = 9U;
+    uint8_t member = 0U;
+
+    for (uint8_t i = 0U; i < QUEUE_SET_MAX_MEMBERS; i++)
+    {
+        queue_init(&queues[i], &storage[i], sizeof(uint32_t), 1U);
+        list[i] = &queues[i];
+    }
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_init(&big, list, (uint8_t)QUEUE_SET_MAX_MEMBERS));
+    queue_set_push(&big, 31U, &value);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_set_next(&big, &member));
+    TEST_ASSERT_EQUAL_UINT8(31U, member);
+}
+
+TEST(queue_set, GivenInvalidParamsThenReturnsError)
+{
+    static queue_t *const with_null[2] = {&can_rx, NULL};
+    uint32_t value = 5U;
+    uint8_t member = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_init(NULL, members, 3U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_init(&set, NULL, 3U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_init(&set, members, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_init(&set, members, (uint8_t)(QUEUE_SET_MAX_MEMBERS + 1U)));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_init(&set, with_null, 2U));
+
+    queue_set_init(&set, members, 3U);
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_push(NULL, 0U, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_push(&set, 3U, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_push(&set, 0U, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_next(NULL, &member));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_next(&set, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_sync(&set, 3U));
+
+    queue_set_push(&set, 0U, &value);
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_pop(&set, NULL, &member));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_set_pop(&set, &value, NULL));
+    TEST_ASSERT_EQUAL_HEX32(0x80000000U, set.ready);
+}
\ No newline at end of file
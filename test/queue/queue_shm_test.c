@@ -0,0 +1,208 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_shm.h"
+#include <string.h> /* for memcpy, memset */
+
+#define REGION_BYTES 1024U
+#define CAPACITY     8U
+
+typedef struct
+{
+    uint32_t id;
+    uint16_t value;
+    uint16_t flags;
+} record_t;
+
+typedef struct
+{
+    QUEUE_CACHE_ALIGNED uint8_t bytes[REGION_BYTES];
+    uint64_t align; /* keeps 8-byte alignment when cache-line alignment is off */
+} region_t;
+
+static region_t region_a;
+static region_t region_b;
+static queue_shm_t producer;
+static queue_shm_t consumer;
+static const queue_shm_config_t cfg = {(uint16_t)sizeof(record_t), CAPACITY};
+
+static void push_records(queue_shm_t *q, uint32_t first, uint32_t n)
+{
+    for (uint32_t i = first; i < (first + n); i++)
+    {
+        const record_t r = {i, (uint16_t)(i * 3U), 0U};
+
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_push(q, &r));
+    }
+}
+
+static void expect_records(queue_shm_t *q, uint32_t first, uint32_t n)
+{
+    record_t r;
+
+    for (uint32_t i = first; i < (first + n); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_pop(q, &r));
+        TEST_ASSERT_EQUAL_UINT32(i, r.id);
+        TEST_ASSERT_EQUAL_UINT16((uint16_t)(i * 3U), r.value);
+    }
+}
+
+TEST_GROUP(queue_shm);
+
+TEST_SETUP(queue_shm)
+{
+    memset(&region_a, 0, sizeof(region_a));
+    memset(&region_b, 0, sizeof(region_b));
+}
+
+TEST_TEAR_DOWN(queue_shm)
+{
+}
+
+TEST(queue_shm, GivenValidGeometryWhenRegionSizeThenCoversHeaderSequencesAndData)
+{
+    const size_t size = queue_shm_region_size(&cfg);
+
+    TEST_ASSERT_TRUE(size >= (sizeof(queue_shm_header_t) + (CAPACITY * 4U) + (CAPACITY * sizeof(record_t))));
+    TEST_ASSERT_TRUE(size <= REGION_BYTES);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, size, &cfg));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)size, producer.header->region_size);
+}
+
+TEST(queue_shm, GivenInvalidGeometryWhenRegionSizeThenReturnsZero)
+{
+    const queue_shm_config_t not_pow2 = {4U, 6U};
+    const queue_shm_config_t too_small = {4U, 1U};
+    const queue_shm_config_t no_size = {0U, 8U};
+    const queue_shm_config_t huge = {0xFFFFU, 0x80000000U};
+
+    TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)queue_shm_region_size(NULL));
+    TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)queue_shm_region_size(&not_pow2));
+    TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)queue_shm_region_size(&too_small));
+    TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)queue_shm_region_size(&no_size));
+    TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)queue_shm_region_size(&huge));
+}
+
+TEST(queue_shm, GivenCreatedQueueWhenPushAndPopThenFifoOrderAcrossWrap)
+{
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &cfg));
+    TEST_ASSERT_TRUE(queue_shm_is_empty(&producer));
+    push_records(&producer, 0U, 5U);
+    expect_records(&producer, 0U, 5U);
+    push_records(&producer, 5U, CAPACITY);
+    expect_records(&producer, 5U, CAPACITY);
+    TEST_ASSERT_TRUE(queue_shm_is_empty(&producer));
+}
+
+TEST(queue_shm, GivenFullOrEmptyQueueThenPushAndPopReportIt)
+{
+    const record_t extra = {99U, 0U, 0U};
+    record_t out = {7U, 7U, 7U};
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_shm_pop(&producer, &out));
+    TEST_ASSERT_EQUAL_UINT32(7U, out.id);
+    push_records(&producer, 0U, CAPACITY);
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_shm_push(&producer, &extra));
+    expect_records(&producer, 0U, CAPACITY);
+}
+
+TEST(queue_shm, GivenCreatedRegionWhenAttachThenBothHandlesShareTheQueue)
+{
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_attach(&consumer, region_a.bytes, REGION_BYTES));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(record_t), consumer.header->element_size);
+    push_records(&producer, 10U, 3U);
+    TEST_ASSERT_FALSE(queue_shm_is_empty(&consumer));
+    expect_records(&consumer, 10U, 3U);
+    TEST_ASSERT_TRUE(queue_shm_is_empty(&producer));
+}
+
+TEST(queue_shm, GivenRegionMappedAtOtherAddressWhenAttachThenContentsReadable)
+{
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &cfg));
+    push_records(&producer, 0U, 6U);
+    expect_records(&producer, 0U, 2U);
+
+    /* same bytes at another base address, as seen by a second process */
+    memcpy(region_b.bytes, region_a.bytes, REGION_BYTES);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_attach(&consumer, region_b.bytes, REGION_BYTES));
+    expect_records(&consumer, 2U, 4U);
+    push_records(&consumer, 6U, CAPACITY);
+    expect_records(&consumer, 6U, CAPACITY);
+}
+
+TEST(queue_shm, GivenUninitializedOrDamagedHeaderWhenAttachThenRejected)
+{
+    queue_shm_header_t *header = NULL;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(&consumer, region_a.bytes, REGION_BYTES));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &cfg));
+    header = producer.header;
+    header->version = (uint16_t)(QUEUE_SHM_VERSION + 1U);
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(&consumer, region_a.bytes, REGION_BYTES));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &cfg));
+    header->data_offset += 8U;
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(&consumer, region_a.bytes, REGION_BYTES));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &cfg));
+    header->capacity = 6U;
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(&consumer, region_a.bytes, REGION_BYTES));
+}
+
+TEST(queue_shm, GivenHeaderGeometryChangedAfterAttachWhenPushPopThenAccessesStayInRegion)
+{
+    const size_t size = queue_shm_region_size(&cfg);
+    queue_shm_header_t *header = NULL;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, size, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_attach(&consumer, region_a.bytes, size));
+    header = producer.header;
+    header->index_mask = 0xFFFFFFFFU;
+    header->element_size = 0xFFFFU;
+    header->capacity = 0x80000000U;
+
+    push_records(&producer, 0U, 5U);
+    expect_records(&consumer, 0U, 5U);
+    push_records(&consumer, 5U, CAPACITY);
+    expect_records(&producer, 5U, CAPACITY);
+    for (size_t i = size; i < REGION_BYTES; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0U, region_a.bytes[i]);
+    }
+}
+
+TEST(queue_shm, GivenMappingSmallerThanQueueWhenAttachThenRejected)
+{
+    const size_t size = queue_shm_region_size(&cfg);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, size, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_attach(&consumer, region_a.bytes, size));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(&consumer, region_a.bytes, size - 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(&consumer, region_a.bytes, 4U));
+}
+
+TEST(queue_shm, GivenInvalidParamsThenReturnsError)
+{
+    const queue_shm_config_t not_pow2 = {4U, 6U};
+    const record_t r = {0U, 0U, 0U};
+    record_t out;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_create(NULL, region_a.bytes, REGION_BYTES, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_create(&producer, NULL, REGION_BYTES, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_create(&producer, &region_a.bytes[4], REGION_BYTES - 4U, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_create(&producer, region_a.bytes, 16U, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &not_pow2));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(NULL, region_a.bytes, REGION_BYTES));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(&consumer, NULL, REGION_BYTES));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_attach(&consumer, &region_a.bytes[4], REGION_BYTES - 4U));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_shm_create(&producer, region_a.bytes, REGION_BYTES, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_push(NULL, &r));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_push(&producer, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_pop(NULL, &out));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_shm_pop(&producer, NULL));
+    TEST_ASSERT_TRUE(queue_shm_is_empty(NULL));
+}
\ No newline at end of file
@@ -0,0 +1,310 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_snapshot.h"
+#include "queue_search.h"
+#include <string.h> /* for memset */
+
+#define CAPACITY    8U
+#define FLASH_BYTES 1024U
+#define HEADER_SIZE ((uint32_t)sizeof(queue_snapshot_header_t))
+
+static queue_t src;
+static queue_t dst;
+static uint32_t src_buffer[CAPACITY];
+static uint32_t dst_buffer[CAPACITY];
+static queue_snapshot_t snap;
+static uint8_t flash[FLASH_BYTES];
+static uint32_t flash_used;
+static bool flash_fail;
+
+static bool flash_write(void *ctx, const void *data, uint32_t size)
+{
+    bool ok = !flash_fail && ((flash_used + size) <= FLASH_BYTES);
+
+    (void)ctx;
+    if (ok)
+    {
+        memcpy(&flash[flash_used], data, size);
+        flash_used += size;
+    }
+
+    return ok;
+}
+
+static const queue_snapshot_sink_t sink = {flash_write, NULL};
+
+static void push_range(queue_t *q, uint32_t first, uint32_t n)
+{
+    for (uint32_t i = first; i < (first + n); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(q, &i));
+    }
+}
+
+/* replay every record in flash into dst; returns the number of records applied */
+static uint32_t restore_all(void)
+{
+    uint32_t offset = 0U;
+    uint32_t used = 0U;
+    uint32_t records = 0U;
+
+    while (queue_snapshot_restore(&dst, &flash[offset], FLASH_BYTES - offset, &used) == QUEUE_OK)
+    {
+        offset += used;
+        records++;
+    }
+
+    return records;
+}
+
+static void expect_same_contents(void)
+{
+    uint32_t expected = 0U;
+    uint32_t actual = 0U;
+
+    TEST_ASSERT_EQUAL_UINT32(queue_count(&src), queue_count(&dst));
+    for (queue_index_t i = 0U; i < queue_count(&src); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_peek_at(&src, i, &expected));
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_peek_at(&dst, i, &actual));
+        TEST_ASSERT_EQUAL_UINT32(expected, actual);
+    }
+}
+
+/* values with the same tens digit are equivalent */
+static bool same_group(const void *queued, const void *item)
+{
+    return (*(const uint32_t *)queued / 10U) == (*(const uint32_t *)item / 10U);
+}
+
+static const queue_snapshot_header_t *flash_header(uint32_t offset)
+{
+    return (const queue_snapshot_header_t *)&flash[offset];
+}
+
+TEST_GROUP(queue_snapshot);
+
+TEST_SETUP(queue_snapshot)
+{
+    memset(flash, 0xFF, sizeof(flash));
+    flash_used = 0U;
+    flash_fail = false;
+    queue_init(&src, src_buffer, sizeof(uint32_t), CAPACITY);
+    queue_init(&dst, dst_buffer, sizeof(uint32_t), CAPACITY);
+    queue_snapshot_init(&snap, &src, &sink);
+}
+
+TEST_TEAR_DOWN(queue_snapshot)
+{
+}
+
+TEST(queue_snapshot, GivenWrappedQueueWhenFullRecordRestoredThenContentsAndOrderMatch)
+{
+    uint32_t written = 0U;
+    uint32_t used = 0U;
+
+    push_range(&src, 0U, 6U);
+    (void)queue_read_advance(&src, 4U);
+    push_range(&src, 6U, 5U); /* 7 elements across the wrap point */
+    push_range(&dst, 90U, 3U); /* restore replaces existing contents */
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_full(&snap, &written));
+    TEST_ASSERT_EQUAL_UINT32(HEADER_SIZE + (7U * sizeof(uint32_t)), written);
+    TEST_ASSERT_EQUAL_UINT32(written, flash_used);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_restore(&dst, flash, flash_used, &used));
+    TEST_ASSERT_EQUAL_UINT32(written, used);
+    expect_same_contents();
+}
+
+TEST(queue_snapshot, GivenFewElementsWhenFullRecordThenSizeScalesWithCountNotCapacity)
+{
+    uint32_t written = 0U;
+
+    push_range(&src, 0U, 1U);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_full(&snap, &written));
+    TEST_ASSERT_EQUAL_UINT32(HEADER_SIZE + sizeof(uint32_t), written);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(uint32_t), flash_header(0U)->element_size);
+    TEST_ASSERT_EQUAL_UINT32(CAPACITY, flash_header(0U)->capacity);
+    TEST_ASSERT_EQUAL_UINT32(1U, flash_header(0U)->live);
+}
+
+TEST(queue_snapshot, GivenNoPreviousRecordWhenDeltaThenFullRecordWritten)
+{
+    push_range(&src, 0U, 3U);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_delta(&snap, NULL));
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_SNAPSHOT_FULL, flash_header(0U)->kind);
+    TEST_ASSERT_EQUAL_UINT32(3U, flash_header(0U)->count);
+}
+
+TEST(queue_snapshot, GivenCheckpointWhenDeltaThenOnlyNewElementsWritten)
+{
+    uint32_t written = 0U;
+
+    push_range(&src, 0U, 5U);
+    (void)queue_snapshot_full(&snap, NULL);
+    flash_used = 0U;
+    push_range(&src, 5U, 2U);
+    (void)queue_read_advance(&src, 3U);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_delta(&snap, &written));
+    TEST_ASSERT_EQUAL_UINT32(HEADER_SIZE + (2U * sizeof(uint32_t)), written);
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_SNAPSHOT_DELTA, flash_header(0U)->kind);
+    TEST_ASSERT_EQUAL_UINT32(5U, flash_header(0U)->base_seq);
+    TEST_ASSERT_EQUAL_UINT32(7U, flash_header(0U)->seq);
+    TEST_ASSERT_EQUAL_UINT32(4U, flash_header(0U)->live);
+}
+
+TEST(queue_snapshot, GivenFullAndDeltaChainWhenRestoredThenQueueMatchesSource)
+{
+    push_range(&src, 0U, 5U);
+    (void)queue_snapshot_full(&snap, NULL);
+    push_range(&src, 5U, 2U);
+    (void)queue_snapshot_delta(&snap, NULL);
+    (void)queue_read_advance(&src, 4U); /* pops only: header-only delta */
+    (void)queue_snapshot_delta(&snap, NULL);
+    (void)queue_read_advance(&src, 1U);
+    push_range(&src, 7U, 6U);
+    (void)queue_snapshot_delta(&snap, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(4U, restore_all());
+    expect_same_contents();
+    TEST_ASSERT_EQUAL_UINT32(src.push_seq, dst.push_seq);
+}
+
+TEST(queue_snapshot, GivenRemoveIfSinceCheckpointWhenDeltaThenFullRecordRestoresContents)
+{
+    static const queue_search_key_t key = {0U, 4U};
+    queue_index_t removed = 0U;
+
+    push_range(&src, 1U, 3U);
+    (void)queue_snapshot_full(&snap, NULL);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_remove_if(&src, &key, 3U, &removed));
+    TEST_ASSERT_EQUAL_UINT16(1U, removed);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_delta(&snap, NULL));
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_SNAPSHOT_FULL, flash_header(HEADER_SIZE + (3U * sizeof(uint32_t)))->kind);
+    TEST_ASSERT_EQUAL_UINT32(2U, restore_all());
+    expect_same_contents();
+}
+
+TEST(queue_snapshot, GivenCoalesceReplaceSinceCheckpointWhenDeltaThenFullRecordRestoresContents)
+{
+    static const queue_coalesce_t policy = {same_group, QUEUE_COALESCE_REPLACE};
+    const uint32_t update = 3U;
+    bool coalesced = false;
+
+    push_range(&src, 1U, 2U);
+    (void)queue_snapshot_full(&snap, NULL);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_coalesce(&src, &update, &policy, &coalesced));
+    TEST_ASSERT_TRUE(coalesced);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_delta(&snap, NULL));
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_SNAPSHOT_FULL, flash_header(HEADER_SIZE + (2U * sizeof(uint32_t)))->kind);
+    TEST_ASSERT_EQUAL_UINT32(2U, restore_all());
+    expect_same_contents();
+}
+
+TEST(queue_snapshot, GivenMorePushesThanLiveElementsWhenDeltaThenOnlyLiveOnesWritten)
+{
+    push_range(&src, 0U, 4U);
+    (void)queue_snapshot_full(&snap, NULL);
+    (void)queue_read_advance(&src, 4U);
+    push_range(&src, 4U, 8U);
+    (void)queue_read_advance(&src, 6U);
+    push_range(&src, 12U, 6U);
+    (void)queue_read_advance(&src, 3U); /* 5 live, 14 pushed since the checkpoint */
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_delta(&snap, NULL));
+    TEST_ASSERT_EQUAL_UINT32(5U, flash_header(HEADER_SIZE + (4U * sizeof(uint32_t)))->count);
+    TEST_ASSERT_EQUAL_UINT32(2U, restore_all());
+    expect_same_contents();
+}
+
+TEST(queue_snapshot, GivenNoChangeSinceCheckpointWhenDeltaThenNothingWritten)
+{
+    uint32_t written = 5U;
+
+    push_range(&src, 0U, 2U);
+    (void)queue_snapshot_full(&snap, NULL);
+    flash_used = 0U;
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_snapshot_delta(&snap, &written));
+    TEST_ASSERT_EQUAL_UINT32(0U, written);
+    TEST_ASSERT_EQUAL_UINT32(0U, flash_used);
+}
+
+TEST(queue_snapshot, GivenDamagedRecordWhenRestoreThenErrorAndQueueUnchanged)
+{
+    push_range(&src, 0U, 3U);
+    (void)queue_snapshot_full(&snap, NULL);
+    push_range(&dst, 50U, 2U);
+
+    flash[HEADER_SIZE + 1U] ^= 0x01U;
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_restore(&dst, flash, flash_used, NULL));
+    flash[HEADER_SIZE + 1U] ^= 0x01U;
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_restore(&dst, flash, flash_used - 1U, NULL));
+    TEST_ASSERT_EQUAL_UINT32(2U, queue_count(&dst));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_restore(&dst, flash, flash_used, NULL));
+    TEST_ASSERT_EQUAL_UINT32(3U, queue_count(&dst));
+}
+
+TEST(queue_snapshot, GivenErasedOrShortStorageWhenRestoreThenEmpty)
+{
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_snapshot_restore(&dst, flash, FLASH_BYTES, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_snapshot_restore(&dst, flash, HEADER_SIZE - 1U, NULL));
+}
+
+TEST(queue_snapshot, GivenDeltaNotContinuingQueueStateWhenRestoreThenError)
+{
+    uint32_t used = 0U;
+
+    push_range(&src, 0U, 2U);
+    (void)queue_snapshot_full(&snap, &used);
+    push_range(&src, 2U, 2U);
+    (void)queue_snapshot_delta(&snap, NULL);
+
+    /* delta without its base full record */
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_restore(&dst, &flash[used], flash_used - used, NULL));
+    TEST_ASSERT_TRUE(queue_is_empty(&dst));
+}
+
+TEST(queue_snapshot, GivenIncompatibleQueueWhenRestoreThenError)
+{
+    uint16_t narrow_buffer[CAPACITY];
+    uint32_t small_buffer[2];
+    queue_t narrow;
+    queue_t small;
+
+    push_range(&src, 0U, 3U);
+    (void)queue_snapshot_full(&snap, NULL);
+    queue_init(&narrow, narrow_buffer, sizeof(uint16_t), CAPACITY);
+    queue_init(&small, small_buffer, sizeof(uint32_t), 2U);
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_restore(&narrow, flash, flash_used, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_restore(&small, flash, flash_used, NULL));
+}
+
+TEST(queue_snapshot, GivenSinkFailureWhenCheckpointThenErrorAndNextDeltaRepeatsElements)
+{
+    push_range(&src, 0U, 2U);
+    (void)queue_snapshot_full(&snap, NULL);
+    push_range(&src, 2U, 3U);
+
+    flash_fail = true;
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_delta(&snap, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_full(&snap, NULL));
+    flash_fail = false;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_snapshot_delta(&snap, NULL));
+    TEST_ASSERT_EQUAL_UINT32(3U, flash_header(HEADER_SIZE + (2U * sizeof(uint32_t)))->count);
+}
+
+TEST(queue_snapshot, GivenInvalidParamsThenReturnsError)
+{
+    const queue_snapshot_sink_t no_hook = {NULL, NULL};
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_init(NULL, &src, &sink));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_init(&snap, NULL, &sink));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_init(&snap, &src, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_init(&snap, &src, &no_hook));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_full(NULL, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_delta(NULL, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_restore(NULL, flash, FLASH_BYTES, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_snapshot_restore(&dst, NULL, FLASH_BYTES, NULL));
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_soa.h"
+#include <stddef.h> /* for offsetof */
+
+#define QUEUE_CAPACITY 3U
+
+typedef struct
+{
+    uint16_t id;
+    uint8_t flags;
+    uint32_t payload[4];
+} wide_record_t;
+
+static uint16_t ids[QUEUE_CAPACITY];
+static uint8_t flags[QUEUE_CAPACITY];
+static uint32_t payloads[QUEUE_CAPACITY][4];
+static const queue_soa_field_t fields[3] = {
+    {ids, (uint16_t)offsetof(wide_record_t, id), (uint16_t)sizeof(uint16_t)},
+    {flags, (uint16_t)offsetof(wide_record_t, flags), (uint16_t)sizeof(uint8_t)},
+    {payloads, (uint16_t)offsetof(wide_record_t, payload), (uint16_t)(4U * sizeof(uint32_t))},
+};
+static queue_soa_t q;
+
+static wide_record_t make_record(uint16_t id)
+{
+    wide_record_t r = {id, (uint8_t)(id + 1U), {id, id, id, id}};
+
+    return r;
+}
+
+TEST_GROUP(queue_soa);
+
+TEST_SETUP(queue_soa)
+{
+    queue_soa_init(&q, fields, 3U, QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_soa)
+{
+}
+
+TEST(queue_soa, GivenPushThenEachFieldStoredInItsOwnSubBuffer)
+{
+    wide_record_t r = make_record(7U);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_soa_push(&q, &r));
+    TEST_ASSERT_EQUAL_UINT16(7U, ids[0]);
+    TEST_ASSERT_EQUAL_UINT8(8U, flags[0]);
+    TEST_ASSERT_EQUAL_UINT32(7U, payloads[0][3]);
+    TEST_ASSERT_FALSE(queue_soa_is_empty(&q));
+}
+
+TEST(queue_soa, GivenAllFieldsMaskWhenPopThenWholeRecordRestored)
+{
+    wide_record_t in = make_record(3U);
+    wide_record_t out = make_record(0U);
+
+    queue_soa_push(&q, &in);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_soa_pop(&q, &out, QUEUE_SOA_ALL_FIELDS));
+    TEST_ASSERT_EQUAL_UINT16(in.id, out.id);
+    TEST_ASSERT_EQUAL_UINT8(in.flags, out.flags);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(in.payload, out.payload, 4U);
+    TEST_ASSERT_TRUE(queue_soa_is_empty(&q));
+}
+
+TEST(queue_soa, GivenIdOnlyMaskWhenPopThenOtherFieldsUntouched)
+{
+    wide_record_t in = make_record(5U);
+    wide_record_t out = make_record(0U);
+
+    out.flags = 0xEEU;
+    out.payload[0] = 0xDEADBEEFU;
+    queue_soa_push(&q, &in);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_soa_pop(&q, &out, QUEUE_SOA_FIELD(0U)));
+    TEST_ASSERT_EQUAL_UINT16(5U, out.id);
+    TEST_ASSERT_EQUAL_UINT8(0xEEU, out.flags);
+    TEST_ASSERT_EQUAL_HEX32(0xDEADBEEFU, out.payload[0]);
+}
+
+TEST(queue_soa, GivenPeekWithMaskThenRecordStaysQueued)
+{
+    wide_record_t in = make_record(9U);
+    wide_record_t out = make_record(0U);
+
+    queue_soa_push(&q, &in);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_soa_peek(&q, &out, QUEUE_SOA_FIELD(1U)));
+    TEST_ASSERT_EQUAL_UINT8(10U, out.flags);
+    TEST_ASSERT_EQUAL_UINT16(0U, out.id);
+    TEST_ASSERT_EQUAL_UINT16(1U, q.count);
+}
+
+TEST(queue_soa, GivenZeroMaskWhenPopWithNullRecordThenRecordDropped)
+{
+    wide_record_t in = make_record(1U);
+
+    queue_soa_push(&q, &in);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_soa_pop(&q, NULL, 0U));
+    TEST_ASSERT_TRUE(queue_soa_is_empty(&q));
+}
+
+TEST(queue_soa, GivenFullQueueWhenPushThenReturnsFull)
+{
+    wide_record_t r = make_record(1U);
+
+    for (uint32_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_soa_push(&q, &r));
+    }
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_soa_push(&q, &r));
+}
+
+TEST(queue_soa, GivenEmptyQueueWhenPopOrPeekThenReturnsEmpty)
+{
+    wide_record_t out = make_record(4U);
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_soa_pop(&q, &out, QUEUE_SOA_ALL_FIELDS));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_soa_peek(&q, &out, QUEUE_SOA_ALL_FIELDS));
+    TEST_ASSERT_EQUAL_UINT16(4U, out.id);
+}
+
+TEST(queue_soa, GivenWrappedQueueWhenFieldViewThenTwoArraysInFifoOrder)
+{
+    wide_record_t r = make_record(0U);
+    queue_soa_view_t view;
+
+    for (uint16_t i = 1U; i <= QUEUE_CAPACITY; i++)
+    {
+        r = make_record(i);
+        queue_soa_push(&q, &r);
+    }
+    queue_soa_pop(&q, NULL, 0U);
+    queue_soa_pop(&q, NULL, 0U);
+    r = make_record(4U);
+    queue_soa_push(&q, &r);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_soa_field_view(&q, 0U, &view));
+    TEST_ASSERT_EQUAL_UINT16(1U, view.first_count);
+    TEST_ASSERT_EQUAL_UINT16(3U, ((const uint16_t *)view.first)[0]);
+    TEST_ASSERT_EQUAL_UINT16(1U, view.second_count);
+    TEST_ASSERT_EQUAL_PTR(ids, view.second);
+    TEST_ASSERT_EQUAL_UINT16(4U, ((const uint16_t *)view.second)[0]);
+}
+
+TEST(queue_soa, GivenContiguousQueueWhenFieldViewThenSecondArrayEmpty)
+{
+    wide_record_t r = make_record(2U);
+    queue_soa_view_t view;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_soa_field_view(&q, 1U, &view));
+    TEST_ASSERT_EQUAL_UINT16(0U, view.first_count);
+
+    queue_soa_push(&q, &r);
+    queue_soa_push(&q, &r);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_soa_field_view(&q, 1U, &view));
+    TEST_ASSERT_EQUAL_PTR(flags, view.first);
+    TEST_ASSERT_EQUAL_UINT16(2U, view.first_count);
+    TEST_ASSERT_NULL(view.second);
+    TEST_ASSERT_EQUAL_UINT16(0U, view.second_count);
+}
+
+TEST(queue_soa, GivenInvalidParamsThenReturnsError)
+{
+    const queue_soa_field_t no_buffer[1] = {{NULL, 0U, 2U}};
+    const queue_soa_field_t no_size[1] = {{ids, 0U, 0U}};
+    wide_record_t r = make_record(1U);
+    queue_soa_view_t view;
+    queue_soa_t other;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_init(NULL, fields, 3U, QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_init(&other, NULL, 3U, QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_init(&other, fields, 0U, QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_init(&other, fields, (uint8_t)(QUEUE_SOA_MAX_FIELDS + 1U), QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_init(&other, fields, 3U, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_init(&other, no_buffer, 1U, QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_init(&other, no_size, 1U, QUEUE_CAPACITY));
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_push(NULL, &r));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_push(&q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_pop(NULL, &r, QUEUE_SOA_ALL_FIELDS));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_pop(&q, NULL, QUEUE_SOA_ALL_FIELDS));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_peek(NULL, &r, QUEUE_SOA_ALL_FIELDS));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_peek(&q, NULL, QUEUE_SOA_ALL_FIELDS));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_field_view(NULL, 0U, &view));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_field_view(&q, 3U, &view));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_soa_field_view(&q, 0U, NULL));
+    TEST_ASSERT_TRUE(queue_soa_is_empty(NULL));
+}
\ No newline at end of file
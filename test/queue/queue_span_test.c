@@ -0,0 +1,152 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define QUEUE_CAPACITY 5
+
+static queue_t q;
+static uint8_t buffer[QUEUE_CAPACITY];
+
+TEST_GROUP(queue_span);
+
+TEST_SETUP(queue_span)
+{
+    queue_init(&q, buffer, sizeof(uint8_t), QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_span)
+{
+}
+
+/* Simulates a DMA transfer writing `n` bytes starting with `first`. */
+static void dma_fill(void *span, queue_index_t n, uint8_t first)
+{
+    uint8_t *dst = (uint8_t *)span;
+
+    for (queue_index_t i = 0U; i < n; i++)
+    {
+        dst[i] = (uint8_t)(first + i);
+    }
+}
+
+// Test empty queue exposes the whole buffer as one writable span
+TEST(queue_span, GivenEmptyQueueWhenWriteSpanThenWholeBufferWritable)
+{
+    void *span = NULL;
+    queue_index_t n = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_span(&q, &span, &n));
+    TEST_ASSERT_EQUAL_PTR(buffer, span);
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_CAPACITY, n);
+}
+
+// Test empty queue has no readable span
+TEST(queue_span, GivenEmptyQueueWhenReadSpanThenReturnsQueueEmpty)
+{
+    const void *span = &q;
+    queue_index_t n = 9U;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_read_span(&q, &span, &n));
+    TEST_ASSERT_EQUAL_UINT16(0U, n);
+    TEST_ASSERT_EQUAL_PTR(&q, span);
+}
+
+// Test DMA style fill + write_advance makes data visible to pop
+TEST(queue_span, GivenWriteSpanFilledWhenWriteAdvanceThenElementsCanBePopped)
+{
+    void *span = NULL;
+    queue_index_t n = 0U;
+    uint8_t out = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_span(&q, &span, &n));
+    dma_fill(span, 3U, 10U);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_advance(&q, 3U));
+
+    TEST_ASSERT_EQUAL(3, q.count);
+    for (uint8_t i = 0U; i < 3U; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+        TEST_ASSERT_EQUAL_UINT8(10U + i, out);
+    }
+}
+
+// Test spans stop at the wrap point and continue at buffer start
+TEST(queue_span, GivenWrappedDataWhenReadSpanThenTwoSpansCoverAllElements)
+{
+    const void *span = NULL;
+    uint8_t in[QUEUE_CAPACITY] = {1U, 2U, 3U, 4U, 5U};
+    queue_index_t moved = 0U;
+    queue_index_t n = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, 4U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_read_advance(&q, 3U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, in, 3U, &moved));
+
+    /* stored: 4 | 1 2 3 -> head = 3, first span [3..4], second [0..1] */
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_read_span(&q, &span, &n));
+    TEST_ASSERT_EQUAL_PTR(&buffer[3], span);
+    TEST_ASSERT_EQUAL_UINT16(2U, n);
+    TEST_ASSERT_EQUAL_UINT8(4U, ((const uint8_t *)span)[0]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_read_advance(&q, n));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_read_span(&q, &span, &n));
+    TEST_ASSERT_EQUAL_PTR(&buffer[0], span);
+    TEST_ASSERT_EQUAL_UINT16(2U, n);
+    TEST_ASSERT_EQUAL_UINT8(2U, ((const uint8_t *)span)[0]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_read_advance(&q, n));
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test write span is limited by free space before the head
+TEST(queue_span, GivenWrappedTailWhenWriteSpanThenLimitedByFreeSpace)
+{
+    void *span = NULL;
+    queue_index_t n = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_advance(&q, 4U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_read_advance(&q, 2U));
+
+    /* tail = 4, head = 2: one slot till end of buffer */
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_span(&q, &span, &n));
+    TEST_ASSERT_EQUAL_PTR(&buffer[4], span);
+    TEST_ASSERT_EQUAL_UINT16(1U, n);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_advance(&q, n));
+
+    /* tail = 0, head = 2: two slots before the head */
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_span(&q, &span, &n));
+    TEST_ASSERT_EQUAL_PTR(&buffer[0], span);
+    TEST_ASSERT_EQUAL_UINT16(2U, n);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_advance(&q, n));
+
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_write_span(&q, &span, &n));
+    TEST_ASSERT_EQUAL_UINT16(0U, n);
+}
+
+// Test advancing beyond stored data or free space is rejected
+TEST(queue_span, GivenTooLargeAdvanceThenReturnsErrorAndStateUnchanged)
+{
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_read_advance(&q, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_advance(&q, 2U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_write_advance(&q, QUEUE_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_read_advance(&q, 3U));
+
+    TEST_ASSERT_EQUAL(2, q.count);
+    TEST_ASSERT_EQUAL(0, q.head);
+    TEST_ASSERT_EQUAL(2, q.tail);
+}
+
+// Test NULL parameters are rejected
+TEST(queue_span, GivenNullParamsThenReturnsError)
+{
+    const void *rspan = NULL;
+    void *wspan = NULL;
+    queue_index_t n = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_read_span(NULL, &rspan, &n));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_read_span(&q, NULL, &n));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_read_span(&q, &rspan, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_write_span(NULL, &wspan, &n));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_write_span(&q, NULL, &n));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_write_span(&q, &wspan, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_read_advance(NULL, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_write_advance(NULL, 0U));
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_spsc.h"
+#include <stddef.h>
+
+#define SPSC_CAPACITY 4
+
+static queue_spsc_t q;
+static uint32_t buffer[SPSC_CAPACITY];
+
+TEST_GROUP(queue_spsc);
+
+TEST_SETUP(queue_spsc)
+{
+    queue_spsc_init(&q, buffer, sizeof(uint32_t), SPSC_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_spsc)
+{
+}
+
+// Test invalid init arguments are rejected
+TEST(queue_spsc, GivenInvalidParamsWhenInitThenReturnsError)
+{
+    queue_spsc_t local;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_init(NULL, buffer, sizeof(uint32_t), SPSC_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_init(&local, NULL, sizeof(uint32_t), SPSC_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_init(&local, buffer, 0U, SPSC_CAPACITY));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_init(&local, buffer, sizeof(uint32_t), 0U));
+}
+
+// Test new queue reports empty and not full
+TEST(queue_spsc, GivenNewQueueThenIsEmptyAndNotFull)
+{
+    TEST_ASSERT_TRUE(queue_spsc_is_empty(&q));
+    TEST_ASSERT_FALSE(queue_spsc_is_full(&q));
+}
+
+// Test whole capacity is usable and the next push fails
+TEST(queue_spsc, GivenQueueWhenPushCapacityItemsThenFullAndNextPushFails)
+{
+    uint32_t value = 0U;
+
+    for (uint32_t i = 0U; i < SPSC_CAPACITY; i++)
+    {
+        value = i;
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_push(&q, &value));
+    }
+
+    TEST_ASSERT_TRUE(queue_spsc_is_full(&q));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_spsc_push(&q, &value));
+}
+
+// Test pop from empty queue leaves item unchanged
+TEST(queue_spsc, GivenEmptyQueueWhenPopOrPeekThenReturnsQueueEmpty)
+{
+    uint32_t out = 0xDEADBEEFU;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_spsc_pop(&q, &out));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_spsc_peek(&q, &out));
+    TEST_ASSERT_EQUAL_HEX32(0xDEADBEEFU, out);
+}
+
+// Test peek returns oldest element without consuming it
+TEST(queue_spsc, GivenItemsWhenPeekThenOldestReturnedAndNotRemoved)
+{
+    uint32_t a = 11U;
+    uint32_t b = 22U;
+    uint32_t out = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_push(&q, &a));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_push(&q, &b));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_peek(&q, &out));
+    TEST_ASSERT_EQUAL_UINT32(a, out);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_peek(&q, &out));
+    TEST_ASSERT_EQUAL_UINT32(a, out);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_pop(&q, &out));
+    TEST_ASSERT_EQUAL_UINT32(a, out);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_pop(&q, &out));
+    TEST_ASSERT_EQUAL_UINT32(b, out);
+    TEST_ASSERT_TRUE(queue_spsc_is_empty(&q));
+}
+
+// Test FIFO order over many wraps of the [0, 2 x capacity) index range
+TEST(queue_spsc, GivenManyWrapCyclesWhenPushPopThenFifoOrderPreserved)
+{
+    uint32_t next_in = 0U;
+    uint32_t next_out = 0U;
+    uint32_t out = 0U;
+
+    for (uint32_t round = 0U; round < (5U * SPSC_CAPACITY); round++)
+    {
+        while (queue_spsc_push(&q, &next_in) == QUEUE_OK)
+        {
+            next_in++;
+        }
+        for (uint32_t i = 0U; i < 3U; i++)
+        {
+            TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_pop(&q, &out));
+            TEST_ASSERT_EQUAL_UINT32(next_out, out);
+            next_out++;
+        }
+    }
+
+    while (queue_spsc_pop(&q, &out) == QUEUE_OK)
+    {
+        TEST_ASSERT_EQUAL_UINT32(next_out, out);
+        next_out++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(next_in, next_out);
+    TEST_ASSERT_UINT32_WITHIN(2U * SPSC_CAPACITY - 1U, 0U, q.head);
+}
+
+// Test NULL parameters are rejected
+TEST(queue_spsc, GivenNullParamsThenReturnsErrorAndSafeValues)
+{
+    uint32_t value = 1U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_push(NULL, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_push(&q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_pop(NULL, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_pop(&q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_peek(NULL, &value));
+    TEST_ASSERT_TRUE(queue_spsc_is_empty(NULL));
+    TEST_ASSERT_FALSE(queue_spsc_is_full(NULL));
+}
+
+// Test producer and consumer fields live on separate cache lines
+TEST(queue_spsc, GivenCacheLineAlignThenHeadAndTailOnSeparateLines)
+{
+    const size_t head_offset = offsetof(queue_spsc_t, head);
+    const size_t tail_offset = offsetof(queue_spsc_t, tail);
+
+    TEST_ASSERT_EQUAL_UINT32(0U, head_offset % QUEUE_CFG_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL_UINT32(0U, tail_offset % QUEUE_CFG_CACHE_LINE_SIZE);
+    TEST_ASSERT_TRUE(offsetof(queue_spsc_t, tail_cache) < tail_offset);
+    TEST_ASSERT_EQUAL_UINT32(0U, sizeof(queue_spsc_t) % QUEUE_CFG_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL_UINT32(0U, ((uintptr_t)&q) % QUEUE_CFG_CACHE_LINE_SIZE);
+}
+
+// Test cached indices are refreshed only when the queue looks full or empty
+TEST(queue_spsc, GivenStaleCachedIndexWhenFullOrEmptyThenSharedIndexReloaded)
+{
+    uint32_t value = 1U;
+
+    for (uint32_t i = 0U; i < SPSC_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_push(&q, &value));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, q.tail_cache);
+
+    /* first pop reloads tail once, the following ones use the cached copy */
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_pop(&q, &value));
+    TEST_ASSERT_EQUAL_UINT32(SPSC_CAPACITY, q.tail_cache);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_pop(&q, &value));
+
+    /* producer still sees the stale head until the queue looks full */
+    TEST_ASSERT_EQUAL_UINT32(0U, q.head_cache);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_push(&q, &value));
+    TEST_ASSERT_EQUAL_UINT32(2U, q.head_cache);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_push(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_spsc_push(&q, &value));
+}
\ No newline at end of file
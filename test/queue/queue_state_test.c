@@ -75,4 +75,29 @@ TEST(queue_state, GivenCountDecrementedFromCapacityThenIsFullBecomesFalse)
 
     q.count--;
     TEST_ASSERT_FALSE(queue_is_full(&q));
+}
+
+// Test that count and free space follow push and pop
+TEST(queue_state, GivenPushAndPopThenCountAndFreeSpaceTrackContents)
+{
+    int value = 5;
+
+    TEST_ASSERT_EQUAL_UINT32(0U, queue_count(&q));
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_CAPACITY, queue_free_space(&q));
+
+    queue_push(&q, &value);
+    queue_push(&q, &value);
+    TEST_ASSERT_EQUAL_UINT32(2U, queue_count(&q));
+    TEST_ASSERT_EQUAL_UINT32(1U, queue_free_space(&q));
+
+    queue_pop(&q, &value);
+    TEST_ASSERT_EQUAL_UINT32(1U, queue_count(&q));
+    TEST_ASSERT_EQUAL_UINT32(2U, queue_free_space(&q));
+}
+
+// Test that a NULL queue pointer reports no elements and no free space
+TEST(queue_state, GivenNullQueuePointerThenCountAndFreeSpaceAreZero)
+{
+    TEST_ASSERT_EQUAL_UINT32(0U, queue_count(NULL));
+    TEST_ASSERT_EQUAL_UINT32(0U, queue_free_space(NULL));
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define QUEUE_CAPACITY 3
+
+static queue_t q;
+static int buffer[QUEUE_CAPACITY];
+static queue_stats_t stats;
+
+TEST_GROUP(queue_stats);
+
+TEST_SETUP(queue_stats)
+{
+    queue_init(&q, buffer, sizeof(int), QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_stats)
+{
+}
+
+// Test init clears all counters
+TEST(queue_stats, GivenNewQueueThenAllCountersAreZero)
+{
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_get_stats(&q, &stats));
+    TEST_ASSERT_EQUAL_UINT16(0U, stats.high_water_mark);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.pops);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.full_rejections);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.empty_misses);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.overwrites);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.coalesced);
+}
+
+// Test high-water mark keeps the peak occupancy
+TEST(queue_stats, GivenPushesAndPopsThenHighWaterMarkKeepsPeak)
+{
+    int value = 1;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_get_stats(&q, &stats));
+    TEST_ASSERT_EQUAL_UINT16(2U, stats.high_water_mark);
+    TEST_ASSERT_EQUAL_UINT32(3U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.pops);
+}
+
+// Test rejected pushes and pops are counted
+TEST(queue_stats, GivenFullAndEmptyQueueThenRejectionsAndMissesCounted)
+{
+    int value = 1;
+    void *slot = NULL;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_pop(&q, &value));
+    for (int i = 0; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+    }
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_push(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_reserve(&q, &slot));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_get_stats(&q, &stats));
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.full_rejections);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.empty_misses);
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_CAPACITY, stats.high_water_mark);
+}
+
+// Test batch, span and zero-copy operations are accounted per element
+TEST(queue_stats, GivenBatchSpanAndZeroCopyOpsThenElementCountsAccumulate)
+{
+    int items[QUEUE_CAPACITY] = {1, 2, 3};
+    queue_index_t moved = 0U;
+    void *slot = NULL;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_n(&q, items, 2U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_reserve(&q, &slot));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_commit(&q));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_n(&q, items, 2U, &moved));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_release(&q));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_write_advance(&q, 2U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_read_advance(&q, 1U));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_get_stats(&q, &stats));
+    TEST_ASSERT_EQUAL_UINT32(5U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT32(4U, stats.pops);
+    TEST_ASSERT_EQUAL_UINT16(3U, stats.high_water_mark);
+}
+
+// Test overwrite push counts dropped elements
+TEST(queue_stats, GivenOverloadWhenPushOverwriteThenOverwritesCounted)
+{
+    int value = 1;
+
+    for (int i = 0; i < (QUEUE_CAPACITY + 2); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_overwrite(&q, &value, NULL));
+    }
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_get_stats(&q, &stats));
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.overwrites);
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_CAPACITY + 2U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT16(QUEUE_CAPACITY, stats.high_water_mark);
+}
+
+// Test reset clears counters and restarts high-water mark at current count
+TEST(queue_stats, GivenCountersWhenResetThenClearedAndHighWaterIsCurrentCount)
+{
+    int value = 1;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &value));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_reset_stats(&q));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_get_stats(&q, &stats));
+    TEST_ASSERT_EQUAL_UINT16(1U, stats.high_water_mark);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats.pops);
+}
+
+// Test NULL parameters are rejected
+TEST(queue_stats, GivenNullParamsThenReturnsError)
+{
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_get_stats(NULL, &stats));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_get_stats(&q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_reset_stats(NULL));
+}
\ No newline at end of file
@@ -18,4 +18,29 @@ static void run_all_tests(void)
     RUN_TEST_GROUP(queue_state);
     RUN_TEST_GROUP(queue_core);
     RUN_TEST_GROUP(DV_QUEUE_001);
+    RUN_TEST_GROUP(queue_copy);
+    RUN_TEST_GROUP(queue_batch);
+    RUN_TEST_GROUP(queue_spsc);
+    RUN_TEST_GROUP(queue_pow2);
+    RUN_TEST_GROUP(queue_zero_copy);
+    RUN_TEST_GROUP(queue_typed);
+    RUN_TEST_GROUP(queue_span);
+    RUN_TEST_GROUP(queue_overwrite);
+    RUN_TEST_GROUP(queue_stats);
+    RUN_TEST_GROUP(queue_msg);
+    RUN_TEST_GROUP(queue_mpmc);
+    RUN_TEST_GROUP(queue_wait);
+    RUN_TEST_GROUP(queue_wait_futex);
+    RUN_TEST_GROUP(queue_prio);
+    RUN_TEST_GROUP(queue_iter);
+    RUN_TEST_GROUP(queue_coalesce);
+    RUN_TEST_GROUP(queue_set);
+    RUN_TEST_GROUP(queue_timed);
+    RUN_TEST_GROUP(queue_soa);
+    RUN_TEST_GROUP(queue_search);
+    RUN_TEST_GROUP(queue_shm);
+    RUN_TEST_GROUP(queue_snapshot);
+    RUN_TEST_GROUP(queue_trace);
+    RUN_TEST_GROUP(queue_transaction);
+    RUN_TEST_GROUP(queue_copy_hook);
 }
\ No newline at end of file
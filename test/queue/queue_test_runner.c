@@ -1,4 +1,5 @@
 #include "unity/fixture/unity_fixture.h"
+#include "queue_config.h"
 
 /* -------------------------- */
 /* Queue Initialization Tests */
@@ -13,6 +14,9 @@ TEST_GROUP_RUNNER(queue_init)
     RUN_TEST_CASE(queue_init, GivenValidParamsThenQueueIsEmptyAfterInit);
     RUN_TEST_CASE(queue_init, GivenQueueInitializedTwiceThenStateIsCorrect);
     RUN_TEST_CASE(queue_init, GivenMaxElementSizeAndCapacityThenInitSucceeds);
+#if (QUEUE_CFG_INDEX_BITS == 32)
+    RUN_TEST_CASE(queue_init, GivenBufferAbove4GiBWhenInitThenReturnsError);
+#endif
 }
 /* -------------------------- */
 /* Queue Push Tests */
@@ -65,6 +69,8 @@ TEST_GROUP_RUNNER(queue_state)
     RUN_TEST_CASE(queue_state, GivenPartiallyFilledQueueThenIsEmptyAndIsFullReturnFalse);
     RUN_TEST_CASE(queue_state, GivenCountIncrementedToCapacityThenIsFullBecomesTrue);
     RUN_TEST_CASE(queue_state, GivenCountDecrementedFromCapacityThenIsFullBecomesFalse);
+    RUN_TEST_CASE(queue_state, GivenPushAndPopThenCountAndFreeSpaceTrackContents);
+    RUN_TEST_CASE(queue_state, GivenNullQueuePointerThenCountAndFreeSpaceAreZero);
 }
 
 /* -------------------------- */
@@ -98,4 +104,381 @@ TEST_GROUP_RUNNER(DV_QUEUE_001)
     RUN_TEST_CASE(DV_QUEUE_001, PushPopFloatMaintainsAlignment);
     RUN_TEST_CASE(DV_QUEUE_001, MultipleQueuesOperateIndependently);
     RUN_TEST_CASE(DV_QUEUE_001, PushPopBoundaryWrapAround);
+}
+
+/* -------------------------- */
+/* Copy Engine Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_copy)
+{
+    RUN_TEST_CASE(queue_copy, GivenAlignedBuffersWhenCopyFastPathSizesThenDataMatches);
+    RUN_TEST_CASE(queue_copy, GivenAlignedBuffersWhenCopyOddSizesThenWordLoopAndTailMatch);
+    RUN_TEST_CASE(queue_copy, GivenUnalignedSourceWhenCopyThenDataMatches);
+    RUN_TEST_CASE(queue_copy, GivenUnalignedDestinationWhenCopyThenDataMatchesAndGuardsIntact);
+    RUN_TEST_CASE(queue_copy, GivenHalfWordAlignedBuffersWhenCopyTwoBytesThenDataMatches);
+    RUN_TEST_CASE(queue_copy, GivenZeroSizeWhenCopyThenDestinationUnchanged);
+    RUN_TEST_CASE(queue_copy, Given16ByteElementsWhenPushPopWithWrapThenDataMatches);
+    RUN_TEST_CASE(queue_copy, Given32ByteLogEntriesWhenPushPeekPopThenDataMatches);
+}
+
+/* -------------------------- */
+/* Batch Push / Pop Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_batch)
+{
+    RUN_TEST_CASE(queue_batch, GivenEmptyQueueWhenPushNThenAllItemsAddedInOrder);
+    RUN_TEST_CASE(queue_batch, GivenPartiallyFilledQueueWhenPushNExceedsFreeSpaceThenPrefixAdded);
+    RUN_TEST_CASE(queue_batch, GivenFullQueueWhenPushNThenReturnsQueueFull);
+    RUN_TEST_CASE(queue_batch, GivenEmptyQueueWhenPopNThenReturnsQueueEmptyAndItemsUnchanged);
+    RUN_TEST_CASE(queue_batch, GivenQueueWhenPopNExceedsCountThenAllStoredItemsReturned);
+    RUN_TEST_CASE(queue_batch, GivenWrapAroundWhenPushNAndPopNThenOrderIsPreserved);
+    RUN_TEST_CASE(queue_batch, GivenMaxCapacityWhenBatchCrossesWrapThenIndexWrapsInRange);
+    RUN_TEST_CASE(queue_batch, GivenZeroLengthRequestThenReturnsOkAndStateUnchanged);
+    RUN_TEST_CASE(queue_batch, GivenNullParamsWhenPushNOrPopNThenReturnsError);
+}
+
+/* -------------------------- */
+/* SPSC Queue Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_spsc)
+{
+    RUN_TEST_CASE(queue_spsc, GivenInvalidParamsWhenInitThenReturnsError);
+    RUN_TEST_CASE(queue_spsc, GivenNewQueueThenIsEmptyAndNotFull);
+    RUN_TEST_CASE(queue_spsc, GivenQueueWhenPushCapacityItemsThenFullAndNextPushFails);
+    RUN_TEST_CASE(queue_spsc, GivenEmptyQueueWhenPopOrPeekThenReturnsQueueEmpty);
+    RUN_TEST_CASE(queue_spsc, GivenItemsWhenPeekThenOldestReturnedAndNotRemoved);
+    RUN_TEST_CASE(queue_spsc, GivenManyWrapCyclesWhenPushPopThenFifoOrderPreserved);
+    RUN_TEST_CASE(queue_spsc, GivenNullParamsThenReturnsErrorAndSafeValues);
+    RUN_TEST_CASE(queue_spsc, GivenCacheLineAlignThenHeadAndTailOnSeparateLines);
+    RUN_TEST_CASE(queue_spsc, GivenStaleCachedIndexWhenFullOrEmptyThenSharedIndexReloaded);
+}
+
+/* -------------------------- */
+/* Power-of-Two / Wrap Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_pow2)
+{
+    RUN_TEST_CASE(queue_pow2, GivenPowerOfTwoCapacityWhenInitThenMaskIsSet);
+    RUN_TEST_CASE(queue_pow2, GivenNonPowerOfTwoCapacityWhenInitThenReturnsError);
+    RUN_TEST_CASE(queue_pow2, GivenCapacityOneWhenPushPopThenBehavesAsFifo);
+    RUN_TEST_CASE(queue_pow2, GivenMaskedQueueWhenWrapSeveralTimesThenOrderIsPreserved);
+    RUN_TEST_CASE(queue_pow2, GivenMaskedQueueWhenBatchWrapsThenIndicesWrapCorrectly);
+    RUN_TEST_CASE(queue_pow2, GivenMaskedQueueWhenReinitWithQueueInitThenMaskCleared);
+    RUN_TEST_CASE(queue_pow2, GivenNonPowerOfTwoQueueWhenWrapThenIndexRestartsAtZero);
+}
+
+/* -------------------------- */
+/* Zero-Copy Reserve / Acquire Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_zero_copy)
+{
+    RUN_TEST_CASE(queue_zero_copy, GivenEmptyQueueWhenReserveAndCommitThenElementIsQueued);
+    RUN_TEST_CASE(queue_zero_copy, GivenFullQueueWhenReserveOrCommitThenReturnsQueueFull);
+    RUN_TEST_CASE(queue_zero_copy, GivenQueuedElementWhenAcquireThenPointsIntoBufferAndStateUnchanged);
+    RUN_TEST_CASE(queue_zero_copy, GivenAcquiredElementWhenReleaseThenNextElementBecomesHead);
+    RUN_TEST_CASE(queue_zero_copy, GivenEmptyQueueWhenAcquireOrReleaseThenReturnsQueueEmpty);
+    RUN_TEST_CASE(queue_zero_copy, GivenWrapAroundWhenReserveAndAcquireThenSlotsFollowRing);
+    RUN_TEST_CASE(queue_zero_copy, GivenNullParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Typed Queue Generator Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_typed)
+{
+    RUN_TEST_CASE(queue_typed, GivenDefinedQueueThenIsEmptyAndNotFull);
+    RUN_TEST_CASE(queue_typed, GivenTypedQueueWhenPushToCapacityThenFullAndNextPushFails);
+    RUN_TEST_CASE(queue_typed, GivenTypedQueueWhenWrapAroundThenFifoOrderPreserved);
+    RUN_TEST_CASE(queue_typed, GivenTypedQueueWhenPeekThenOldestReturnedAndEmptyReported);
+    RUN_TEST_CASE(queue_typed, GivenStructQueueWhenPushPopThenFramesMatch);
+    RUN_TEST_CASE(queue_typed, GivenNullParamsThenReturnsErrorAndSafeValues);
+}
+
+/* -------------------------- */
+/* Contiguous Span (DMA) Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_span)
+{
+    RUN_TEST_CASE(queue_span, GivenEmptyQueueWhenWriteSpanThenWholeBufferWritable);
+    RUN_TEST_CASE(queue_span, GivenEmptyQueueWhenReadSpanThenReturnsQueueEmpty);
+    RUN_TEST_CASE(queue_span, GivenWriteSpanFilledWhenWriteAdvanceThenElementsCanBePopped);
+    RUN_TEST_CASE(queue_span, GivenWrappedDataWhenReadSpanThenTwoSpansCoverAllElements);
+    RUN_TEST_CASE(queue_span, GivenWrappedTailWhenWriteSpanThenLimitedByFreeSpace);
+    RUN_TEST_CASE(queue_span, GivenTooLargeAdvanceThenReturnsErrorAndStateUnchanged);
+    RUN_TEST_CASE(queue_span, GivenNullParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Overwrite-Oldest Push Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_overwrite)
+{
+    RUN_TEST_CASE(queue_overwrite, GivenNotFullQueueWhenPushOverwriteThenNoOverwriteReported);
+    RUN_TEST_CASE(queue_overwrite, GivenFullQueueWhenPushOverwriteThenOldestDroppedAndReported);
+    RUN_TEST_CASE(queue_overwrite, GivenOverloadWhenPushOverwriteManyThenNewestElementsKept);
+    RUN_TEST_CASE(queue_overwrite, GivenNullOverwrittenFlagWhenPushOverwriteThenSucceeds);
+    RUN_TEST_CASE(queue_overwrite, GivenNullParamsWhenPushOverwriteThenReturnsError);
+}
+
+/* -------------------------- */
+/* Statistics / High-Water-Mark Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_stats)
+{
+    RUN_TEST_CASE(queue_stats, GivenNewQueueThenAllCountersAreZero);
+    RUN_TEST_CASE(queue_stats, GivenPushesAndPopsThenHighWaterMarkKeepsPeak);
+    RUN_TEST_CASE(queue_stats, GivenFullAndEmptyQueueThenRejectionsAndMissesCounted);
+    RUN_TEST_CASE(queue_stats, GivenBatchSpanAndZeroCopyOpsThenElementCountsAccumulate);
+    RUN_TEST_CASE(queue_stats, GivenOverloadWhenPushOverwriteThenOverwritesCounted);
+    RUN_TEST_CASE(queue_stats, GivenCountersWhenResetThenClearedAndHighWaterIsCurrentCount);
+    RUN_TEST_CASE(queue_stats, GivenNullParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Variable-length record queue */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_msg)
+{
+    RUN_TEST_CASE(queue_msg, GivenInvalidArgsWhenInitThenReturnsError);
+    RUN_TEST_CASE(queue_msg, GivenNewQueueThenEmptyAndFreeSpaceIsBufferMinusHeader);
+    RUN_TEST_CASE(queue_msg, GivenRecordsOfDifferentLengthWhenPopThenOrderAndLengthPreserved);
+    RUN_TEST_CASE(queue_msg, GivenInsufficientSpaceWhenPushThenReturnsFull);
+    RUN_TEST_CASE(queue_msg, GivenRecordsCrossingBufferEndWhenPopThenPayloadIntact);
+    RUN_TEST_CASE(queue_msg, GivenTooSmallDestinationWhenPopThenErrorAndRecordKept);
+    RUN_TEST_CASE(queue_msg, GivenZeroLengthRecordWhenPushPopThenLengthZero);
+    RUN_TEST_CASE(queue_msg, GivenNullParamsThenReturnsErrorAndSafeValues);
+}
+
+/* -------------------------- */
+/* Lock-free MPMC queue */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_mpmc)
+{
+    RUN_TEST_CASE(queue_mpmc, GivenInvalidArgsWhenInitThenReturnsError);
+    RUN_TEST_CASE(queue_mpmc, GivenNewQueueWhenPopThenReturnsEmpty);
+    RUN_TEST_CASE(queue_mpmc, GivenFullQueueWhenPushThenReturnsFull);
+    RUN_TEST_CASE(queue_mpmc, GivenManyWrapAroundsWhenPushPopThenFifoOrderPreserved);
+    RUN_TEST_CASE(queue_mpmc, GivenPushAndPopThenSlotSequenceAdvancesByCapacity);
+    RUN_TEST_CASE(queue_mpmc, GivenIndicesNearWrapWhenPushPopThenFifoOrderPreserved);
+    RUN_TEST_CASE(queue_mpmc, GivenNullParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Blocking wait/notify layer */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_wait)
+{
+    RUN_TEST_CASE(queue_wait, GivenInvalidConfigWhenInitThenReturnsError);
+    RUN_TEST_CASE(queue_wait, GivenEmptyQueueAndZeroTimeoutWhenPopThenEmptyWithoutWaiting);
+    RUN_TEST_CASE(queue_wait, GivenEmptyQueueWhenPopTimesOutThenReturnsEmpty);
+    RUN_TEST_CASE(queue_wait, GivenWaitingConsumerWhenProducerPushesThenPopSucceeds);
+    RUN_TEST_CASE(queue_wait, GivenWaitingProducerWhenConsumerPopsThenPushSucceeds);
+    RUN_TEST_CASE(queue_wait, GivenFullQueueWhenPushTimesOutThenReturnsFull);
+    RUN_TEST_CASE(queue_wait, GivenSteadyTrafficThenNotifyOnlyOnEdges);
+    RUN_TEST_CASE(queue_wait, GivenLockHooksWhenPushPopThenLockedAndBalanced);
+    RUN_TEST_CASE(queue_wait, GivenNullParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Futex wait backend */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_wait_futex)
+{
+    RUN_TEST_CASE(queue_wait_futex, GivenEmptyQueueWhenTimedPopThenTimesOut);
+    RUN_TEST_CASE(queue_wait_futex, GivenNotifyAfterPrepareWhenWaitThenReturnsWithoutSleeping);
+    RUN_TEST_CASE(queue_wait_futex, GivenPushesWhenQueueWasEmptyThenEventCounterAdvancedOnce);
+    RUN_TEST_CASE(queue_wait_futex, GivenNullWhenInitThenNoCrash);
+}
+
+/* -------------------------- */
+/* Priority queue (binary heap) */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_prio)
+{
+    RUN_TEST_CASE(queue_prio, GivenInvalidArgsWhenInitThenReturnsError);
+    RUN_TEST_CASE(queue_prio, GivenNewQueueWhenPopThenReturnsEmpty);
+    RUN_TEST_CASE(queue_prio, GivenMixedPrioritiesWhenPopThenAscendingPriorityOrder);
+    RUN_TEST_CASE(queue_prio, GivenEqualPrioritiesWhenPopThenFifoOrderWithinPriority);
+    RUN_TEST_CASE(queue_prio, GivenPseudoRandomTrafficWhenPopThenNeverLessUrgentThanRemaining);
+    RUN_TEST_CASE(queue_prio, GivenElementsWhenPeekThenMostUrgentAndCountUnchanged);
+    RUN_TEST_CASE(queue_prio, GivenNullParamsThenReturnsErrorAndSafeValues);
+}
+
+/* -------------------------- */
+/* Queue Peek-At / Iterator Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_iter)
+{
+    RUN_TEST_CASE(queue_iter, GivenWrappedQueueWhenPeekAtEachOffsetThenReturnsElementsInFifoOrder);
+    RUN_TEST_CASE(queue_iter, GivenOffsetNotBelowCountWhenPeekAtThenReturnsEmptyAndItemUnchanged);
+    RUN_TEST_CASE(queue_iter, GivenNullParamsWhenPeekAtThenReturnsError);
+    RUN_TEST_CASE(queue_iter, GivenWrappedQueueWhenIteratingThenPointersFollowRingWithoutCopying);
+    RUN_TEST_CASE(queue_iter, GivenEmptyQueueWhenIteratingThenFirstNextReturnsEmpty);
+    RUN_TEST_CASE(queue_iter, GivenPushDuringScanWhenIteratingThenOnlyInitialElementsVisited);
+    RUN_TEST_CASE(queue_iter, GivenNullParamsWhenIterThenReturnsError);
+}
+
+/* -------------------------- */
+/* Queue Coalescing Push Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_coalesce)
+{
+    RUN_TEST_CASE(queue_coalesce, GivenEmptyQueueWhenPushCoalesceThenElementAddedWithoutCompare);
+    RUN_TEST_CASE(queue_coalesce, GivenEquivalentNewestWhenReplaceThenNewestUpdatedInPlace);
+    RUN_TEST_CASE(queue_coalesce, GivenEquivalentNewestWhenDropThenNewItemDiscarded);
+    RUN_TEST_CASE(queue_coalesce, GivenInterleavedEventsWhenPushCoalesceThenOnlyNewestCompared);
+    RUN_TEST_CASE(queue_coalesce, GivenTailAtSlotZeroWhenPushCoalesceThenLastSlotIsNewest);
+    RUN_TEST_CASE(queue_coalesce, GivenFullQueueWhenPushCoalesceThenOnlyEquivalentItemAccepted);
+    RUN_TEST_CASE(queue_coalesce, GivenCoalescedPushesThenStatsCountThemSeparately);
+    RUN_TEST_CASE(queue_coalesce, GivenNullParamsWhenPushCoalesceThenReturnsError);
+}
+
+/* -------------------------- */
+/* Queue Set Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_set)
+{
+    RUN_TEST_CASE(queue_set, GivenEmptyMembersWhenNextThenReturnsEmpty);
+    RUN_TEST_CASE(queue_set, GivenPushToMemberThenItsReadyBitIsSet);
+    RUN_TEST_CASE(queue_set, GivenSeveralReadyMembersWhenPopThenLowestIndexServedFirst);
+    RUN_TEST_CASE(queue_set, GivenMemberWithTwoElementsWhenPopThenBitClearedOnlyWhenDrained);
+    RUN_TEST_CASE(queue_set, GivenFullMemberWhenPushThenReturnsFull);
+    RUN_TEST_CASE(queue_set, GivenNonEmptyMembersWhenInitThenReadyReflectsState);
+    RUN_TEST_CASE(queue_set, GivenDirectQueueCallsWhenSyncThenReadyBitFollowsMember);
+    RUN_TEST_CASE(queue_set, GivenThirtyTwoMembersWhenOnlyLastReadyThenNextSelectsIt);
+    RUN_TEST_CASE(queue_set, GivenInvalidParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Timestamped Queue Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_timed)
+{
+    RUN_TEST_CASE(queue_timed, GivenPushThenSlotStampHoldsClockValue);
+    RUN_TEST_CASE(queue_timed, GivenFreshElementWhenPopFreshThenReturnedWithLatency);
+    RUN_TEST_CASE(queue_timed, GivenExpiredHeadElementsWhenPopFreshThenSkippedAndCounted);
+    RUN_TEST_CASE(queue_timed, GivenElementAgeEqualMaxAgeWhenPopFreshThenStillFresh);
+    RUN_TEST_CASE(queue_timed, GivenAllExpiredWhenPopFreshThenQueueDrainedAndEmptyReturned);
+    RUN_TEST_CASE(queue_timed, GivenWrappedStampsWhenPopFreshThenScanWraps);
+    RUN_TEST_CASE(queue_timed, GivenClockWrapWhenPopFreshThenAgeUsesWrappedDifference);
+    RUN_TEST_CASE(queue_timed, GivenFullQueueWhenPushThenReturnsFullAndStampsUnchanged);
+    RUN_TEST_CASE(queue_timed, GivenInvalidParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Struct-of-Arrays Queue Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_soa)
+{
+    RUN_TEST_CASE(queue_soa, GivenPushThenEachFieldStoredInItsOwnSubBuffer);
+    RUN_TEST_CASE(queue_soa, GivenAllFieldsMaskWhenPopThenWholeRecordRestored);
+    RUN_TEST_CASE(queue_soa, GivenIdOnlyMaskWhenPopThenOtherFieldsUntouched);
+    RUN_TEST_CASE(queue_soa, GivenPeekWithMaskThenRecordStaysQueued);
+    RUN_TEST_CASE(queue_soa, GivenZeroMaskWhenPopWithNullRecordThenRecordDropped);
+    RUN_TEST_CASE(queue_soa, GivenFullQueueWhenPushThenReturnsFull);
+    RUN_TEST_CASE(queue_soa, GivenEmptyQueueWhenPopOrPeekThenReturnsEmpty);
+    RUN_TEST_CASE(queue_soa, GivenWrappedQueueWhenFieldViewThenTwoArraysInFifoOrder);
+    RUN_TEST_CASE(queue_soa, GivenContiguousQueueWhenFieldViewThenSecondArrayEmpty);
+    RUN_TEST_CASE(queue_soa, GivenInvalidParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Queue Search Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_search)
+{
+    RUN_TEST_CASE(queue_search, GivenPackedWrappedQueueWhenFindThenOffsetFromHeadReturned);
+    RUN_TEST_CASE(queue_search, GivenNoMatchWhenFindThenReturnsEmptyAndOffsetUnchanged);
+    RUN_TEST_CASE(queue_search, GivenStaleDataOutsideStoredRangeWhenFindThenNotReported);
+    RUN_TEST_CASE(queue_search, GivenPackedDuplicatesWhenCountIfThenAllMatchesCounted);
+    RUN_TEST_CASE(queue_search, GivenByteKeysWhenFindAndCountThenValueTruncatedToWidth);
+    RUN_TEST_CASE(queue_search, GivenStridedKeyWhenFindThenFieldAtOffsetCompared);
+    RUN_TEST_CASE(queue_search, GivenMatchesWhenRemoveIfThenSurvivorsKeepFifoOrder);
+    RUN_TEST_CASE(queue_search, GivenNoMatchWhenRemoveIfThenQueueUnchanged);
+    RUN_TEST_CASE(queue_search, GivenAllMatchWhenRemoveIfThenQueueEmptiedAtHead);
+    RUN_TEST_CASE(queue_search, GivenInvalidParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Queue Shared Memory Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_shm)
+{
+    RUN_TEST_CASE(queue_shm, GivenValidGeometryWhenRegionSizeThenCoversHeaderSequencesAndData);
+    RUN_TEST_CASE(queue_shm, GivenInvalidGeometryWhenRegionSizeThenReturnsZero);
+    RUN_TEST_CASE(queue_shm, GivenCreatedQueueWhenPushAndPopThenFifoOrderAcrossWrap);
+    RUN_TEST_CASE(queue_shm, GivenFullOrEmptyQueueThenPushAndPopReportIt);
+    RUN_TEST_CASE(queue_shm, GivenCreatedRegionWhenAttachThenBothHandlesShareTheQueue);
+    RUN_TEST_CASE(queue_shm, GivenRegionMappedAtOtherAddressWhenAttachThenContentsReadable);
+    RUN_TEST_CASE(queue_shm, GivenUninitializedOrDamagedHeaderWhenAttachThenRejected);
+    RUN_TEST_CASE(queue_shm, GivenHeaderGeometryChangedAfterAttachWhenPushPopThenAccessesStayInRegion);
+    RUN_TEST_CASE(queue_shm, GivenMappingSmallerThanQueueWhenAttachThenRejected);
+    RUN_TEST_CASE(queue_shm, GivenInvalidParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Queue Snapshot Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_snapshot)
+{
+    RUN_TEST_CASE(queue_snapshot, GivenWrappedQueueWhenFullRecordRestoredThenContentsAndOrderMatch);
+    RUN_TEST_CASE(queue_snapshot, GivenFewElementsWhenFullRecordThenSizeScalesWithCountNotCapacity);
+    RUN_TEST_CASE(queue_snapshot, GivenNoPreviousRecordWhenDeltaThenFullRecordWritten);
+    RUN_TEST_CASE(queue_snapshot, GivenCheckpointWhenDeltaThenOnlyNewElementsWritten);
+    RUN_TEST_CASE(queue_snapshot, GivenFullAndDeltaChainWhenRestoredThenQueueMatchesSource);
+    RUN_TEST_CASE(queue_snapshot, GivenRemoveIfSinceCheckpointWhenDeltaThenFullRecordRestoresContents);
+    RUN_TEST_CASE(queue_snapshot, GivenCoalesceReplaceSinceCheckpointWhenDeltaThenFullRecordRestoresContents);
+    RUN_TEST_CASE(queue_snapshot, GivenMorePushesThanLiveElementsWhenDeltaThenOnlyLiveOnesWritten);
+    RUN_TEST_CASE(queue_snapshot, GivenNoChangeSinceCheckpointWhenDeltaThenNothingWritten);
+    RUN_TEST_CASE(queue_snapshot, GivenDamagedRecordWhenRestoreThenErrorAndQueueUnchanged);
+    RUN_TEST_CASE(queue_snapshot, GivenErasedOrShortStorageWhenRestoreThenEmpty);
+    RUN_TEST_CASE(queue_snapshot, GivenDeltaNotContinuingQueueStateWhenRestoreThenError);
+    RUN_TEST_CASE(queue_snapshot, GivenIncompatibleQueueWhenRestoreThenError);
+    RUN_TEST_CASE(queue_snapshot, GivenSinkFailureWhenCheckpointThenErrorAndNextDeltaRepeatsElements);
+    RUN_TEST_CASE(queue_snapshot, GivenInvalidParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Queue Trace Tests */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_trace)
+{
+    RUN_TEST_CASE(queue_trace, GivenClockWhenInitThenOverheadIsShortestReadPairAndHistogramsCleared);
+    RUN_TEST_CASE(queue_trace, GivenTracedCallsThenResultsPassThroughAndLandInTheirHistogram);
+    RUN_TEST_CASE(queue_trace, GivenFailingCallsThenMeasuredToo);
+    RUN_TEST_CASE(queue_trace, GivenClockWrapDuringCallThenDurationStillCorrect);
+    RUN_TEST_CASE(queue_trace, GivenHistogramWhenQuantileThenBucketBoundCoveringShareReturned);
+    RUN_TEST_CASE(queue_trace, GivenSamplesInLastBucketWhenQuantileThenSaturatedBound);
+    RUN_TEST_CASE(queue_trace, GivenSamplesWhenDumpAndResetThenCallbackPerOpAndHistogramsCleared);
+    RUN_TEST_CASE(queue_trace, GivenOperationWhenOpNameThenShortName);
+    RUN_TEST_CASE(queue_trace, GivenInvalidParamsThenReturnsError);
+}
+
+/* -------------------------- */
+/* Atomic Transactions */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_transaction)
+{
+    RUN_TEST_CASE(queue_transaction, GivenEmptyQueueWhenPushAllThenPopExactReturnsFrameInOrder);
+    RUN_TEST_CASE(queue_transaction, GivenInsufficientSpaceWhenPushAllThenNothingAdded);
+    RUN_TEST_CASE(queue_transaction, GivenFewerElementsWhenPopExactThenNothingRemoved);
+    RUN_TEST_CASE(queue_transaction, GivenWrappedIndicesWhenPushAllThenFrameSplitAcrossEnd);
+    RUN_TEST_CASE(queue_transaction, GivenInvalidArgsWhenTransactionThenReturnsError);
+    RUN_TEST_CASE(queue_transaction, GivenSpscQueueWhenPushAllAndPopExactThenFrameAtomic);
+    RUN_TEST_CASE(queue_transaction, GivenMpmcQueueWhenPushAllAndPopExactThenFrameAtomic);
+}
+
+/* -------------------------- */
+/* Copy Hooks */
+/* -------------------------- */
+TEST_GROUP_RUNNER(queue_copy_hook)
+{
+    RUN_TEST_CASE(queue_copy_hook, GivenInvalidArgsWhenInitExThenReturnsError);
+    RUN_TEST_CASE(queue_copy_hook, GivenHookedQueueWhenPushPopThenHooksMoveData);
+    RUN_TEST_CASE(queue_copy_hook, GivenHookedQueueWhenPeekThenCopyOutUsed);
+    RUN_TEST_CASE(queue_copy_hook, GivenWrappedBlockWhenPushNThenHookCalledPerSegment);
+    RUN_TEST_CASE(queue_copy_hook, GivenOnlyCopyInHookWhenPopThenCopyEngineUsed);
+    RUN_TEST_CASE(queue_copy_hook, GivenHookedQueueWhenReinitWithQueueInitThenHooksRemoved);
+    RUN_TEST_CASE(queue_copy_hook, GivenHookedQueueWhenRemoveIfThenKeptElementsMovedThroughCopyIn);
+    RUN_TEST_CASE(queue_copy_hook, GivenHookedQueuesWhenSnapshotRestoredThenContentsUnchanged);
 }
\ No newline at end of file
@@ -0,0 +1,177 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_timed.h"
+
+#define QUEUE_CAPACITY 4U
+
+static queue_t q;
+static uint16_t buffer[QUEUE_CAPACITY];
+static uint32_t stamps[QUEUE_CAPACITY];
+static queue_timed_t t;
+static uint32_t fake_time;
+
+static uint32_t fake_clock(void *ctx)
+{
+    (void)ctx;
+    return fake_time;
+}
+
+static void push_at(uint32_t time, uint16_t value)
+{
+    fake_time = time;
+    queue_timed_push(&t, &value);
+}
+
+TEST_GROUP(queue_timed);
+
+TEST_SETUP(queue_timed)
+{
+    const queue_timed_config_t cfg = {stamps, fake_clock, NULL};
+
+    queue_init(&q, buffer, sizeof(uint16_t), QUEUE_CAPACITY);
+    fake_time = 0U;
+    queue_timed_init(&t, &q, &cfg);
+}
+
+TEST_TEAR_DOWN(queue_timed)
+{
+}
+
+// Test push records the clock value in the stamp of the slot it fills
+TEST(queue_timed, GivenPushThenSlotStampHoldsClockValue)
+{
+    push_at(100U, 1U);
+    push_at(130U, 2U);
+
+    TEST_ASSERT_EQUAL_UINT32(100U, stamps[0]);
+    TEST_ASSERT_EQUAL_UINT32(130U, stamps[1]);
+    TEST_ASSERT_EQUAL_UINT32(2U, queue_count(&q));
+}
+
+// Test fresh elements are returned with their queueing latency
+TEST(queue_timed, GivenFreshElementWhenPopFreshThenReturnedWithLatency)
+{
+    uint16_t value = 0U;
+    queue_timed_info_t info = {9U, 9U};
+
+    push_at(100U, 7U);
+    fake_time = 140U;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_timed_pop_fresh(&t, &value, 50U, &info));
+    TEST_ASSERT_EQUAL_UINT16(7U, value);
+    TEST_ASSERT_EQUAL_UINT32(0U, info.dropped);
+    TEST_ASSERT_EQUAL_UINT32(40U, info.latency);
+}
+
+// Test expired elements at head are dropped without being copied out
+TEST(queue_timed, GivenExpiredHeadElementsWhenPopFreshThenSkippedAndCounted)
+{
+    uint16_t value = 0U;
+    queue_timed_info_t info = {0U, 0U};
+
+    push_at(0U, 1U);
+    push_at(10U, 2U);
+    push_at(90U, 3U);
+    fake_time = 100U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_timed_pop_fresh(&t, &value, 50U, &info));
+    TEST_ASSERT_EQUAL_UINT16(3U, value);
+    TEST_ASSERT_EQUAL_UINT32(2U, info.dropped);
+    TEST_ASSERT_EQUAL_UINT32(10U, info.latency);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test an element exactly max_age old is still fresh
+TEST(queue_timed, GivenElementAgeEqualMaxAgeWhenPopFreshThenStillFresh)
+{
+    uint16_t value = 0U;
+
+    push_at(0U, 5U);
+    fake_time = 50U;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_timed_pop_fresh(&t, &value, 50U, NULL));
+    TEST_ASSERT_EQUAL_UINT16(5U, value);
+}
+
+// Test all-expired queue is drained and reports empty with item unchanged
+TEST(queue_timed, GivenAllExpiredWhenPopFreshThenQueueDrainedAndEmptyReturned)
+{
+    uint16_t value = 0xBEEFU;
+    queue_timed_info_t info = {0U, 7U};
+
+    push_at(0U, 1U);
+    push_at(1U, 2U);
+    fake_time = 1000U;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_timed_pop_fresh(&t, &value, 50U, &info));
+    TEST_ASSERT_EQUAL_UINT16(0xBEEFU, value);
+    TEST_ASSERT_EQUAL_UINT32(2U, info.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0U, info.latency);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test the expiry scan follows the ring across the wrap point
+TEST(queue_timed, GivenWrappedStampsWhenPopFreshThenScanWraps)
+{
+    uint16_t value = 0U;
+    queue_timed_info_t info = {0U, 0U};
+
+    for (uint16_t i = 0U; i < 3U; i++)
+    {
+        push_at(0U, i);
+        queue_timed_pop_fresh(&t, &value, 0xFFFFFFFFU, NULL);
+    }
+    push_at(0U, 10U);  /* slot 3 */
+    push_at(5U, 11U);  /* slot 0 */
+    push_at(80U, 12U); /* slot 1 */
+    fake_time = 100U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_timed_pop_fresh(&t, &value, 50U, &info));
+    TEST_ASSERT_EQUAL_UINT16(12U, value);
+    TEST_ASSERT_EQUAL_UINT32(2U, info.dropped);
+}
+
+// Test ages are computed modulo 2^32 across a clock wrap
+TEST(queue_timed, GivenClockWrapWhenPopFreshThenAgeUsesWrappedDifference)
+{
+    uint16_t value = 0U;
+    queue_timed_info_t info = {0U, 0U};
+
+    push_at(0xFFFFFFF0U, 3U);
+    fake_time = 0x10U;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_timed_pop_fresh(&t, &value, 50U, &info));
+    TEST_ASSERT_EQUAL_UINT32(0x20U, info.latency);
+}
+
+// Test a full queue rejects the push and keeps the existing stamps
+TEST(queue_timed, GivenFullQueueWhenPushThenReturnsFullAndStampsUnchanged)
+{
+    uint16_t value = 1U;
+
+    for (uint32_t i = 0U; i < QUEUE_CAPACITY; i++)
+    {
+        push_at(i, value);
+    }
+    fake_time = 99U;
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_timed_push(&t, &value));
+    TEST_ASSERT_EQUAL_UINT32(0U, stamps[0]);
+}
+
+// Test invalid parameters are rejected
+TEST(queue_timed, GivenInvalidParamsThenReturnsError)
+{
+    const queue_timed_config_t cfg = {stamps, fake_clock, NULL};
+    const queue_timed_config_t no_stamps = {NULL, fake_clock, NULL};
+    const queue_timed_config_t no_clock = {stamps, NULL, NULL};
+    uint16_t value = 1U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_init(NULL, &q, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_init(&t, NULL, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_init(&t, &q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_init(&t, &q, &no_stamps));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_init(&t, &q, &no_clock));
+    queue_push(&q, &value);
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_init(&t, &q, &cfg));
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_push(NULL, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_push(&t, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_pop_fresh(NULL, &value, 0U, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_timed_pop_fresh(&t, NULL, 0U, NULL));
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_trace.h"
+
+#define CAPACITY 4U
+
+typedef struct
+{
+    const uint32_t *values;
+    uint32_t next;
+} script_clock_t;
+
+static queue_t q;
+static uint32_t buffer[CAPACITY];
+static queue_trace_t trace;
+static script_clock_t clock_script;
+static uint32_t dump_calls;
+static queue_trace_op_t dump_ops[QUEUE_TRACE_OPS];
+
+/* calibration reads: pair durations 3, 2, 1, 1 -> overhead 1 */
+static const uint32_t calibration[8] = {0U, 3U, 10U, 12U, 20U, 21U, 30U, 31U};
+
+static uint32_t script_now(void *ctx)
+{
+    script_clock_t *c = (script_clock_t *)ctx;
+
+    return c->values[c->next++];
+}
+
+static void trace_with_script(const uint32_t *values)
+{
+    const queue_trace_config_t cfg = {script_now, &clock_script};
+
+    clock_script.values = values;
+    clock_script.next = 0U;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_init(&trace, &q, &cfg));
+}
+
+static void record_dump(void *ctx, queue_trace_op_t op, const queue_trace_hist_t *hist)
+{
+    (void)ctx;
+    TEST_ASSERT_EQUAL_PTR(&trace.hist[op], hist);
+    dump_ops[dump_calls] = op;
+    dump_calls++;
+}
+
+TEST_GROUP(queue_trace);
+
+TEST_SETUP(queue_trace)
+{
+    queue_init(&q, buffer, sizeof(uint32_t), CAPACITY);
+    dump_calls = 0U;
+}
+
+TEST_TEAR_DOWN(queue_trace)
+{
+}
+
+TEST(queue_trace, GivenClockWhenInitThenOverheadIsShortestReadPairAndHistogramsCleared)
+{
+    trace_with_script(calibration);
+    TEST_ASSERT_EQUAL_UINT32(1U, trace.overhead);
+    TEST_ASSERT_EQUAL_UINT32(8U, clock_script.next);
+    for (uint32_t op = 0U; op < QUEUE_TRACE_OPS; op++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0U, trace.hist[op].samples);
+        TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, trace.hist[op].min);
+        TEST_ASSERT_EQUAL_UINT32(0U, trace.hist[op].max);
+    }
+}
+
+TEST(queue_trace, GivenTracedCallsThenResultsPassThroughAndLandInTheirHistogram)
+{
+    static const uint32_t values[] = {0U, 3U, 10U, 12U, 20U, 21U, 30U, 31U, 100U, 102U, 200U, 206U, 300U, 1301U};
+    uint32_t item = 7U;
+    uint32_t out = 0U;
+
+    trace_with_script(values);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_push(&trace, &item)); /* 1 tick  -> bucket 1 */
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_peek(&trace, &out));  /* 5 ticks -> bucket 3 */
+    TEST_ASSERT_EQUAL_UINT32(7U, out);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_pop(&trace, &out)); /* 1000 ticks -> bucket 10 */
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+
+    TEST_ASSERT_EQUAL_UINT32(1U, trace.hist[QUEUE_TRACE_PUSH].buckets[1]);
+    TEST_ASSERT_EQUAL_UINT32(1U, trace.hist[QUEUE_TRACE_PEEK].buckets[3]);
+    TEST_ASSERT_EQUAL_UINT32(1U, trace.hist[QUEUE_TRACE_POP].buckets[10]);
+    TEST_ASSERT_EQUAL_UINT32(5U, trace.hist[QUEUE_TRACE_PEEK].min);
+    TEST_ASSERT_EQUAL_UINT32(1000U, trace.hist[QUEUE_TRACE_POP].max);
+}
+
+TEST(queue_trace, GivenFailingCallsThenMeasuredToo)
+{
+    static const uint32_t values[] = {0U, 3U, 10U, 12U, 20U, 21U, 30U, 31U, 40U, 41U, 50U, 50U};
+    uint32_t out = 0U;
+
+    trace_with_script(values);
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_trace_pop(&trace, &out));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_push(&trace, NULL)); /* faster than overhead -> 0 */
+    TEST_ASSERT_EQUAL_UINT32(1U, trace.hist[QUEUE_TRACE_POP].buckets[0]);
+    TEST_ASSERT_EQUAL_UINT32(1U, trace.hist[QUEUE_TRACE_PUSH].buckets[0]);
+    TEST_ASSERT_EQUAL_UINT32(0U, trace.hist[QUEUE_TRACE_PUSH].max);
+}
+
+TEST(queue_trace, GivenClockWrapDuringCallThenDurationStillCorrect)
+{
+    static const uint32_t values[] = {0U, 3U, 10U, 12U, 20U, 21U, 30U, 31U, 0xFFFFFFF0U, 0x00000010U};
+    const uint32_t item = 1U;
+
+    trace_with_script(values);
+    (void)queue_trace_push(&trace, &item);
+    TEST_ASSERT_EQUAL_UINT32(31U, trace.hist[QUEUE_TRACE_PUSH].max);
+    TEST_ASSERT_EQUAL_UINT32(1U, trace.hist[QUEUE_TRACE_PUSH].buckets[5]);
+}
+
+TEST(queue_trace, GivenHistogramWhenQuantileThenBucketBoundCoveringShareReturned)
+{
+    queue_trace_hist_t hist = {{0U}, 0U, UINT32_MAX, 0U};
+    uint32_t ticks = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_trace_quantile(&hist, 500U, &ticks));
+    hist.buckets[2] = 90U; /* [2, 4) */
+    hist.buckets[5] = 9U;  /* [16, 32) */
+    hist.buckets[12] = 1U; /* [2048, 4096) */
+    hist.samples = 100U;
+    hist.min = 2U;
+    hist.max = 2500U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_quantile(&hist, 0U, &ticks));
+    TEST_ASSERT_EQUAL_UINT32(4U, ticks);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_quantile(&hist, 900U, &ticks));
+    TEST_ASSERT_EQUAL_UINT32(4U, ticks);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_quantile(&hist, 990U, &ticks));
+    TEST_ASSERT_EQUAL_UINT32(32U, ticks);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_quantile(&hist, 1000U, &ticks));
+    TEST_ASSERT_EQUAL_UINT32(2501U, ticks);
+}
+
+TEST(queue_trace, GivenSamplesInLastBucketWhenQuantileThenSaturatedBound)
+{
+    queue_trace_hist_t hist = {{0U}, 1U, 0x80000000U, 0xFFFFFFFFU};
+    uint32_t ticks = 0U;
+
+    hist.buckets[32] = 1U;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_quantile(&hist, 1000U, &ticks));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, ticks);
+}
+
+TEST(queue_trace, GivenSamplesWhenDumpAndResetThenCallbackPerOpAndHistogramsCleared)
+{
+    static const uint32_t values[] = {0U, 3U, 10U, 12U, 20U, 21U, 30U, 31U, 40U, 45U};
+    const uint32_t item = 1U;
+
+    trace_with_script(values);
+    (void)queue_trace_push(&trace, &item);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_dump(&trace, record_dump, NULL));
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_TRACE_OPS, dump_calls);
+    TEST_ASSERT_EQUAL(QUEUE_TRACE_PUSH, dump_ops[0]);
+    TEST_ASSERT_EQUAL(QUEUE_TRACE_POP, dump_ops[1]);
+    TEST_ASSERT_EQUAL(QUEUE_TRACE_PEEK, dump_ops[2]);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_trace_reset(&trace));
+    TEST_ASSERT_EQUAL_UINT32(0U, trace.hist[QUEUE_TRACE_PUSH].samples);
+    TEST_ASSERT_EQUAL_UINT32(0U, trace.hist[QUEUE_TRACE_PUSH].buckets[3]);
+    TEST_ASSERT_EQUAL_UINT32(1U, trace.overhead);
+}
+
+TEST(queue_trace, GivenOperationWhenOpNameThenShortName)
+{
+    TEST_ASSERT_EQUAL_STRING("push", queue_trace_op_name(QUEUE_TRACE_PUSH));
+    TEST_ASSERT_EQUAL_STRING("pop", queue_trace_op_name(QUEUE_TRACE_POP));
+    TEST_ASSERT_EQUAL_STRING("peek", queue_trace_op_name(QUEUE_TRACE_PEEK));
+    TEST_ASSERT_EQUAL_STRING("?", queue_trace_op_name(QUEUE_TRACE_OPS));
+}
+
+TEST(queue_trace, GivenInvalidParamsThenReturnsError)
+{
+    const queue_trace_config_t no_clock = {NULL, NULL};
+    const queue_trace_config_t cfg = {script_now, &clock_script};
+    queue_trace_hist_t hist = {{0U}, 0U, UINT32_MAX, 0U};
+    uint32_t ticks = 0U;
+    uint32_t item = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_init(NULL, &q, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_init(&trace, NULL, &cfg));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_init(&trace, &q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_init(&trace, &q, &no_clock));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_push(NULL, &item));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_pop(NULL, &item));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_peek(NULL, &item));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_reset(NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_dump(NULL, record_dump, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_dump(&trace, NULL, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_quantile(NULL, 500U, &ticks));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_quantile(&hist, 500U, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_trace_quantile(&hist, 1001U, &ticks));
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+#include "queue_spsc.h"
+#include "queue_mpmc.h"
+
+#define QUEUE_CAPACITY 5
+#define LOCKFREE_CAPACITY 4U
+
+static queue_t q;
+static int buffer[QUEUE_CAPACITY];
+
+static queue_spsc_t spsc;
+static uint32_t spsc_buffer[LOCKFREE_CAPACITY];
+
+static queue_mpmc_t mpmc;
+static uint32_t mpmc_buffer[LOCKFREE_CAPACITY];
+static queue_mpmc_atomic_t mpmc_seq[LOCKFREE_CAPACITY];
+static const queue_mpmc_storage_t mpmc_storage = {mpmc_buffer, mpmc_seq};
+
+TEST_GROUP(queue_transaction);
+
+TEST_SETUP(queue_transaction)
+{
+    queue_init(&q, buffer, sizeof(int), QUEUE_CAPACITY);
+    queue_spsc_init(&spsc, spsc_buffer, sizeof(uint32_t), LOCKFREE_CAPACITY);
+    queue_mpmc_init(&mpmc, &mpmc_storage, sizeof(uint32_t), LOCKFREE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_transaction)
+{
+}
+
+// Test a frame that fits is pushed whole and popped in order
+TEST(queue_transaction, GivenEmptyQueueWhenPushAllThenPopExactReturnsFrameInOrder)
+{
+    const int in[3] = {1, 2, 3};
+    int out[3] = {0, 0, 0};
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_all(&q, in, 3U));
+    TEST_ASSERT_EQUAL(3, q.count);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_exact(&q, out, 3U));
+    TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 3);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test a frame larger than the free space is rejected without touching the queue
+TEST(queue_transaction, GivenInsufficientSpaceWhenPushAllThenNothingAdded)
+{
+    const int in[3] = {10, 11, 12};
+    int first = 9;
+    int out = 0;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &first));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &first));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &first));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_push_all(&q, in, 3U));
+    TEST_ASSERT_EQUAL(3, q.count);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_peek_at(&q, 2U, &out));
+    TEST_ASSERT_EQUAL_INT(9, out);
+    TEST_ASSERT_EQUAL_UINT32(1U, q.stats.full_rejections);
+    TEST_ASSERT_EQUAL_UINT32(3U, q.stats.pushes);
+}
+
+// Test asking for more elements than stored removes nothing
+TEST(queue_transaction, GivenFewerElementsWhenPopExactThenNothingRemoved)
+{
+    const int in[2] = {4, 5};
+    int out[3] = {-1, -1, -1};
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_all(&q, in, 2U));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_pop_exact(&q, out, 3U));
+    TEST_ASSERT_EQUAL(2, q.count);
+    TEST_ASSERT_EQUAL_INT(-1, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(1U, q.stats.empty_misses);
+    TEST_ASSERT_EQUAL_UINT32(0U, q.stats.pops);
+}
+
+// Test a frame crossing the end of the ring keeps its order
+TEST(queue_transaction, GivenWrappedIndicesWhenPushAllThenFrameSplitAcrossEnd)
+{
+    const int pre[4] = {0, 0, 0, 0};
+    const int in[4] = {7, 8, 9, 10};
+    int out[4] = {0, 0, 0, 0};
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_all(&q, pre, 4U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_exact(&q, out, 4U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_all(&q, in, 4U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_exact(&q, out, 4U));
+    TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 4);
+}
+
+// Test invalid arguments and frames larger than the capacity are errors; n = 0 is a no-op
+TEST(queue_transaction, GivenInvalidArgsWhenTransactionThenReturnsError)
+{
+    int items[QUEUE_CAPACITY + 1] = {0};
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_all(NULL, items, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_all(&q, NULL, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_push_all(&q, items, QUEUE_CAPACITY + 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_pop_exact(NULL, items, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_pop_exact(&q, NULL, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_pop_exact(&q, items, QUEUE_CAPACITY + 1U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push_all(&q, items, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop_exact(&q, items, 0U));
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test the SPSC frame is all-or-nothing and wraps correctly
+TEST(queue_transaction, GivenSpscQueueWhenPushAllAndPopExactThenFrameAtomic)
+{
+    const uint32_t in[3] = {1U, 2U, 3U};
+    uint32_t out[3] = {0U, 0U, 0U};
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_push_all(&spsc, in, 3U));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_spsc_push_all(&spsc, in, 2U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_pop_exact(&spsc, out, 2U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_push_all(&spsc, in, 3U));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_spsc_push_all(&spsc, in, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_pop_exact(&spsc, out, 1U));
+    TEST_ASSERT_EQUAL_UINT32(3U, out[0]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_spsc_pop_exact(&spsc, out, 3U));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(in, out, 3);
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_spsc_pop_exact(&spsc, out, 1U));
+    TEST_ASSERT_TRUE(queue_spsc_is_empty(&spsc));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_push_all(&spsc, in, LOCKFREE_CAPACITY + 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_spsc_pop_exact(NULL, out, 1U));
+}
+
+// Test the MPMC frame is claimed as one run and rejected whole when it does not fit
+TEST(queue_transaction, GivenMpmcQueueWhenPushAllAndPopExactThenFrameAtomic)
+{
+    const uint32_t in[3] = {1U, 2U, 3U};
+    uint32_t out[3] = {0U, 0U, 0U};
+    uint32_t single = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_push_all(&mpmc, in, 3U));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_mpmc_push_all(&mpmc, in, 2U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_pop(&mpmc, &single));
+    TEST_ASSERT_EQUAL_UINT32(1U, single);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_push_all(&mpmc, in, 2U));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_mpmc_push_all(&mpmc, in, 1U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_pop_exact(&mpmc, out, 2U));
+    TEST_ASSERT_EQUAL_UINT32(2U, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(3U, out[1]);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_mpmc_pop_exact(&mpmc, out, 2U));
+    TEST_ASSERT_EQUAL_UINT32(1U, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(2U, out[1]);
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_mpmc_pop_exact(&mpmc, out, 1U));
+    TEST_ASSERT_TRUE(queue_mpmc_is_empty(&mpmc));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_push_all(&mpmc, in, LOCKFREE_CAPACITY + 1U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_mpmc_pop_exact(&mpmc, NULL, 1U));
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_typed.h"
+
+#define TYPED_CAPACITY 3
+
+typedef struct
+{
+    uint16_t id;
+    uint8_t len;
+    uint8_t data[5];
+} can_frame_t;
+
+QUEUE_DEFINE(u32_queue, uint32_t, TYPED_CAPACITY)
+QUEUE_DECLARE(frame_queue, can_frame_t, TYPED_CAPACITY)
+
+static frame_queue_t frames;
+
+TEST_GROUP(queue_typed);
+
+TEST_SETUP(queue_typed)
+{
+    u32_queue_init(&u32_queue);
+    frame_queue_init(&frames);
+}
+
+TEST_TEAR_DOWN(queue_typed)
+{
+}
+
+// Test generated instance starts empty
+TEST(queue_typed, GivenDefinedQueueThenIsEmptyAndNotFull)
+{
+    TEST_ASSERT_TRUE(u32_queue_is_empty(&u32_queue));
+    TEST_ASSERT_FALSE(u32_queue_is_full(&u32_queue));
+    TEST_ASSERT_EQUAL_UINT16(0U, u32_queue_count(&u32_queue));
+    TEST_ASSERT_EQUAL(TYPED_CAPACITY, sizeof(u32_queue.buffer) / sizeof(u32_queue.buffer[0]));
+}
+
+// Test push until full then reject
+TEST(queue_typed, GivenTypedQueueWhenPushToCapacityThenFullAndNextPushFails)
+{
+    uint32_t value = 1U;
+
+    for (uint32_t i = 0U; i < TYPED_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, u32_queue_push(&u32_queue, &value));
+    }
+
+    TEST_ASSERT_TRUE(u32_queue_is_full(&u32_queue));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, u32_queue_push(&u32_queue, &value));
+    TEST_ASSERT_EQUAL_UINT16(TYPED_CAPACITY, u32_queue_count(&u32_queue));
+}
+
+// Test FIFO order across wrap-around
+TEST(queue_typed, GivenTypedQueueWhenWrapAroundThenFifoOrderPreserved)
+{
+    uint32_t out = 0U;
+
+    for (uint32_t i = 0U; i < (3U * TYPED_CAPACITY); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, u32_queue_push(&u32_queue, &i));
+        TEST_ASSERT_EQUAL(QUEUE_OK, u32_queue_pop(&u32_queue, &out));
+        TEST_ASSERT_EQUAL_UINT32(i, out);
+    }
+    TEST_ASSERT_TRUE(u32_queue_is_empty(&u32_queue));
+}
+
+// Test peek does not remove and empty queue leaves item unchanged
+TEST(queue_typed, GivenTypedQueueWhenPeekThenOldestReturnedAndEmptyReported)
+{
+    uint32_t in = 77U;
+    uint32_t out = 5U;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, u32_queue_peek(&u32_queue, &out));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, u32_queue_pop(&u32_queue, &out));
+    TEST_ASSERT_EQUAL_UINT32(5U, out);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, u32_queue_push(&u32_queue, &in));
+    TEST_ASSERT_EQUAL(QUEUE_OK, u32_queue_peek(&u32_queue, &out));
+    TEST_ASSERT_EQUAL_UINT32(in, out);
+    TEST_ASSERT_EQUAL_UINT16(1U, u32_queue_count(&u32_queue));
+}
+
+// Test struct elements are copied by assignment
+TEST(queue_typed, GivenStructQueueWhenPushPopThenFramesMatch)
+{
+    can_frame_t in = {0x123U, 5U, {1U, 2U, 3U, 4U, 5U}};
+    can_frame_t out = {0};
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, frame_queue_push(&frames, &in));
+    TEST_ASSERT_EQUAL(QUEUE_OK, frame_queue_pop(&frames, &out));
+    TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(can_frame_t));
+}
+
+// Test NULL parameters are rejected
+TEST(queue_typed, GivenNullParamsThenReturnsErrorAndSafeValues)
+{
+    uint32_t value = 0U;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, u32_queue_init(NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, u32_queue_push(NULL, &value));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, u32_queue_push(&u32_queue, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, u32_queue_pop(&u32_queue, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, u32_queue_peek(NULL, &value));
+    TEST_ASSERT_TRUE(u32_queue_is_empty(NULL));
+    TEST_ASSERT_FALSE(u32_queue_is_full(NULL));
+    TEST_ASSERT_EQUAL_UINT16(0U, u32_queue_count(NULL));
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "unity/fixture/unity_fixture.h"
+#include "port/queue_wait_futex.h"
+
+#define QUEUE_CAPACITY 2
+
+static queue_t q;
+static int buffer[QUEUE_CAPACITY];
+static queue_wait_t w;
+static queue_wait_futex_t not_empty;
+static queue_wait_futex_t not_full;
+
+TEST_GROUP(queue_wait_futex);
+
+TEST_SETUP(queue_wait_futex)
+{
+    const queue_wait_config_t cfg = {&queue_wait_futex_ops, &not_empty, &not_full, {NULL, NULL, NULL}};
+
+    queue_init(&q, buffer, sizeof(int), QUEUE_CAPACITY);
+    queue_wait_futex_init(&not_empty);
+    queue_wait_futex_init(&not_full);
+    queue_wait_init(&w, &q, &cfg);
+}
+
+TEST_TEAR_DOWN(queue_wait_futex)
+{
+}
+
+// Test a timed pop on an empty queue sleeps and expires
+TEST(queue_wait_futex, GivenEmptyQueueWhenTimedPopThenTimesOut)
+{
+    int out = 3;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_wait_pop(&w, &out, 5U));
+    TEST_ASSERT_EQUAL_INT(3, out);
+}
+
+// Test a notify after prepare makes the wait return immediately
+TEST(queue_wait_futex, GivenNotifyAfterPrepareWhenWaitThenReturnsWithoutSleeping)
+{
+    uint32_t timeout = QUEUE_WAIT_FOREVER;
+    const uint32_t token = queue_wait_futex_ops.prepare(&not_empty);
+
+    queue_wait_futex_ops.notify(&not_empty);
+    TEST_ASSERT_TRUE(queue_wait_futex_ops.wait(&not_empty, token, &timeout));
+    TEST_ASSERT_EQUAL_UINT32(QUEUE_WAIT_FOREVER, timeout);
+
+    timeout = 1000U;
+    TEST_ASSERT_TRUE(queue_wait_futex_ops.wait(&not_empty, token, &timeout));
+    TEST_ASSERT_TRUE(timeout > 0U);
+}
+
+// Test push into empty queue advances the consumer's event counter once
+TEST(queue_wait_futex, GivenPushesWhenQueueWasEmptyThenEventCounterAdvancedOnce)
+{
+    int value = 1;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_push(&w, &value, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_push(&w, &value, 0U));
+    TEST_ASSERT_EQUAL_UINT32(1U, not_empty.word);
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_pop(&w, &value, QUEUE_WAIT_FOREVER));
+    TEST_ASSERT_EQUAL_UINT32(1U, not_full.word);
+}
+
+// Test NULL init is ignored
+TEST(queue_wait_futex, GivenNullWhenInitThenNoCrash)
+{
+    queue_wait_futex_init(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0U, not_empty.word);
+}
\ No newline at end of file
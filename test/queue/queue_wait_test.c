@@ -0,0 +1,221 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue_wait.h"
+
+#define QUEUE_CAPACITY 2
+
+typedef struct
+{
+    uint32_t events;
+    uint32_t waits;
+    uint32_t notifies;
+} mock_wait_obj_t;
+
+static queue_t q;
+static int buffer[QUEUE_CAPACITY];
+static queue_wait_t w;
+static mock_wait_obj_t not_empty;
+static mock_wait_obj_t not_full;
+static void (*on_wait)(void);
+static int lock_depth;
+static int lock_calls;
+
+static uint32_t mock_prepare(void *obj)
+{
+    return ((mock_wait_obj_t *)obj)->events;
+}
+
+/* Runs the simulated other side once, then times out unless notified. */
+static bool mock_wait(void *obj, uint32_t token, uint32_t *timeout)
+{
+    mock_wait_obj_t *m = (mock_wait_obj_t *)obj;
+    void (*action)(void) = on_wait;
+    bool woken = true;
+
+    m->waits++;
+    on_wait = NULL;
+    if (action != NULL)
+    {
+        action();
+    }
+    if (m->events == token)
+    {
+        *timeout = 0U;
+        woken = false;
+    }
+
+    return woken;
+}
+
+static void mock_notify(void *obj)
+{
+    ((mock_wait_obj_t *)obj)->events++;
+    ((mock_wait_obj_t *)obj)->notifies++;
+}
+
+static void mock_lock(void *ctx)
+{
+    (void)ctx;
+    lock_depth++;
+    lock_calls++;
+}
+
+static void mock_unlock(void *ctx)
+{
+    (void)ctx;
+    lock_depth--;
+}
+
+static const queue_wait_ops_t mock_ops = {mock_prepare, mock_wait, mock_notify};
+
+static void producer_pushes_one(void)
+{
+    int value = 42;
+
+    (void)queue_wait_push(&w, &value, 0U);
+}
+
+static void consumer_pops_one(void)
+{
+    int value = 0;
+
+    (void)queue_wait_pop(&w, &value, 0U);
+}
+
+TEST_GROUP(queue_wait);
+
+TEST_SETUP(queue_wait)
+{
+    const queue_wait_config_t cfg = {&mock_ops, &not_empty, &not_full, {mock_lock, mock_unlock, NULL}};
+
+    queue_init(&q, buffer, sizeof(int), QUEUE_CAPACITY);
+    not_empty = (mock_wait_obj_t){0U, 0U, 0U};
+    not_full = (mock_wait_obj_t){0U, 0U, 0U};
+    on_wait = NULL;
+    lock_depth = 0;
+    lock_calls = 0;
+    queue_wait_init(&w, &q, &cfg);
+}
+
+TEST_TEAR_DOWN(queue_wait)
+{
+}
+
+// Test init rejects NULL and incomplete configurations
+TEST(queue_wait, GivenInvalidConfigWhenInitThenReturnsError)
+{
+    const queue_wait_ops_t no_wait = {mock_prepare, NULL, mock_notify};
+    const queue_wait_config_t bad_ops = {&no_wait, &not_empty, &not_full, {NULL, NULL, NULL}};
+    const queue_wait_config_t no_ops = {NULL, &not_empty, &not_full, {NULL, NULL, NULL}};
+    const queue_wait_config_t half_lock = {&mock_ops, &not_empty, &not_full, {mock_lock, NULL, NULL}};
+    const queue_wait_config_t no_lock = {&mock_ops, &not_empty, &not_full, {NULL, NULL, NULL}};
+    queue_wait_t other;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_init(NULL, &q, &no_lock));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_init(&other, NULL, &no_lock));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_init(&other, &q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_init(&other, &q, &no_ops));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_init(&other, &q, &bad_ops));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_init(&other, &q, &half_lock));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_init(&other, &q, &no_lock));
+}
+
+// Test zero timeout never waits
+TEST(queue_wait, GivenEmptyQueueAndZeroTimeoutWhenPopThenEmptyWithoutWaiting)
+{
+    int out = 7;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_wait_pop(&w, &out, 0U));
+    TEST_ASSERT_EQUAL_INT(7, out);
+    TEST_ASSERT_EQUAL_UINT32(0U, not_empty.waits);
+}
+
+// Test timeout expiry reports QUEUE_EMPTY after waiting
+TEST(queue_wait, GivenEmptyQueueWhenPopTimesOutThenReturnsEmpty)
+{
+    int out = 0;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_wait_pop(&w, &out, 10U));
+    TEST_ASSERT_EQUAL_UINT32(1U, not_empty.waits);
+    TEST_ASSERT_EQUAL_INT(0, lock_depth);
+}
+
+// Test a push during the wait wakes the consumer and delivers the element
+TEST(queue_wait, GivenWaitingConsumerWhenProducerPushesThenPopSucceeds)
+{
+    int out = 0;
+
+    on_wait = producer_pushes_one;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_pop(&w, &out, QUEUE_WAIT_FOREVER));
+    TEST_ASSERT_EQUAL_INT(42, out);
+    TEST_ASSERT_EQUAL_UINT32(1U, not_empty.notifies);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+}
+
+// Test a pop during the wait wakes the producer and stores the element
+TEST(queue_wait, GivenWaitingProducerWhenConsumerPopsThenPushSucceeds)
+{
+    int value = 5;
+
+    for (int i = 0; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_push(&w, &value, 0U));
+    }
+    on_wait = consumer_pops_one;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_push(&w, &value, 100U));
+    TEST_ASSERT_EQUAL_UINT32(1U, not_full.waits);
+    TEST_ASSERT_EQUAL_UINT32(1U, not_full.notifies);
+    TEST_ASSERT_TRUE(queue_is_full(&q));
+}
+
+// Test full queue with expired timeout reports QUEUE_FULL
+TEST(queue_wait, GivenFullQueueWhenPushTimesOutThenReturnsFull)
+{
+    int value = 5;
+
+    for (int i = 0; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_push(&w, &value, 0U));
+    }
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_wait_push(&w, &value, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_wait_push(&w, &value, 3U));
+    TEST_ASSERT_EQUAL_UINT32(1U, not_full.waits);
+}
+
+// Test notifications fire only on empty->non-empty and full->non-full edges
+TEST(queue_wait, GivenSteadyTrafficThenNotifyOnlyOnEdges)
+{
+    int value = 1;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_push(&w, &value, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_push(&w, &value, 0U));
+    TEST_ASSERT_EQUAL_UINT32(1U, not_empty.notifies);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_pop(&w, &value, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_pop(&w, &value, 0U));
+    TEST_ASSERT_EQUAL_UINT32(1U, not_full.notifies);
+    TEST_ASSERT_EQUAL_UINT32(1U, not_empty.notifies);
+}
+
+// Test every queue access runs inside a balanced lock section
+TEST(queue_wait, GivenLockHooksWhenPushPopThenLockedAndBalanced)
+{
+    int value = 1;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_push(&w, &value, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_wait_pop(&w, &value, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_wait_pop(&w, &value, 0U));
+    TEST_ASSERT_EQUAL_INT(3, lock_calls);
+    TEST_ASSERT_EQUAL_INT(0, lock_depth);
+}
+
+// Test NULL parameters are rejected without touching the backend
+TEST(queue_wait, GivenNullParamsThenReturnsError)
+{
+    int value = 0;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_push(NULL, &value, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_push(&w, NULL, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_pop(NULL, &value, 0U));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_wait_pop(&w, NULL, 0U));
+    TEST_ASSERT_EQUAL_INT(0, lock_calls);
+}
\ No newline at end of file
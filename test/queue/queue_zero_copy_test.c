@@ -0,0 +1,137 @@
+#include "unity/fixture/unity_fixture.h"
+#include "queue.h"
+
+#define QUEUE_CAPACITY 3
+
+typedef struct
+{
+    uint32_t id;
+    uint8_t payload[12];
+} frame_t;
+
+static queue_t q;
+static frame_t buffer[QUEUE_CAPACITY];
+
+TEST_GROUP(queue_zero_copy);
+
+TEST_SETUP(queue_zero_copy)
+{
+    queue_init(&q, buffer, sizeof(frame_t), QUEUE_CAPACITY);
+}
+
+TEST_TEAR_DOWN(queue_zero_copy)
+{
+}
+
+// Test reserve hands out the tail slot and commit publishes it
+TEST(queue_zero_copy, GivenEmptyQueueWhenReserveAndCommitThenElementIsQueued)
+{
+    void *slot = NULL;
+    frame_t out = {0};
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_reserve(&q, &slot));
+    TEST_ASSERT_EQUAL_PTR(&buffer[0], slot);
+    TEST_ASSERT_TRUE(queue_is_empty(&q));
+
+    ((frame_t *)slot)->id = 0x1234U;
+    ((frame_t *)slot)->payload[0] = 0xAAU;
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_commit(&q));
+    TEST_ASSERT_EQUAL(1, q.count);
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_pop(&q, &out));
+    TEST_ASSERT_EQUAL_UINT32(0x1234U, out.id);
+    TEST_ASSERT_EQUAL_HEX8(0xAAU, out.payload[0]);
+}
+
+// Test reserve on a full queue fails and leaves slot untouched
+TEST(queue_zero_copy, GivenFullQueueWhenReserveOrCommitThenReturnsQueueFull)
+{
+    void *slot = &q;
+
+    for (int i = 0; i < QUEUE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_reserve(&q, &slot));
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_commit(&q));
+    }
+
+    slot = &q;
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_reserve(&q, &slot));
+    TEST_ASSERT_EQUAL_PTR(&q, slot);
+    TEST_ASSERT_EQUAL(QUEUE_FULL, queue_commit(&q));
+    TEST_ASSERT_EQUAL(QUEUE_CAPACITY, q.count);
+}
+
+// Test acquire hands out the head element without removing it
+TEST(queue_zero_copy, GivenQueuedElementWhenAcquireThenPointsIntoBufferAndStateUnchanged)
+{
+    frame_t in = {7U, {1U}};
+    const void *slot = NULL;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &in));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_acquire(&q, &slot));
+
+    TEST_ASSERT_EQUAL_PTR(&buffer[0], slot);
+    TEST_ASSERT_EQUAL_UINT32(7U, ((const frame_t *)slot)->id);
+    TEST_ASSERT_EQUAL(1, q.count);
+    TEST_ASSERT_EQUAL(0, q.head);
+}
+
+// Test release removes the acquired element
+TEST(queue_zero_copy, GivenAcquiredElementWhenReleaseThenNextElementBecomesHead)
+{
+    frame_t a = {1U, {0U}};
+    frame_t b = {2U, {0U}};
+    const void *slot = NULL;
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &a));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_push(&q, &b));
+
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_acquire(&q, &slot));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_release(&q));
+    TEST_ASSERT_EQUAL(QUEUE_OK, queue_acquire(&q, &slot));
+    TEST_ASSERT_EQUAL_UINT32(2U, ((const frame_t *)slot)->id);
+    TEST_ASSERT_EQUAL(1, q.count);
+}
+
+// Test acquire / release on an empty queue
+TEST(queue_zero_copy, GivenEmptyQueueWhenAcquireOrReleaseThenReturnsQueueEmpty)
+{
+    const void *slot = &q;
+
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_acquire(&q, &slot));
+    TEST_ASSERT_EQUAL_PTR(&q, slot);
+    TEST_ASSERT_EQUAL(QUEUE_EMPTY, queue_release(&q));
+}
+
+// Test zero-copy slots follow the ring across the wrap point
+TEST(queue_zero_copy, GivenWrapAroundWhenReserveAndAcquireThenSlotsFollowRing)
+{
+    void *slot = NULL;
+    const void *read_slot = NULL;
+
+    for (uint32_t i = 0U; i < (2U * QUEUE_CAPACITY); i++)
+    {
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_reserve(&q, &slot));
+        TEST_ASSERT_EQUAL_PTR(&buffer[i % QUEUE_CAPACITY], slot);
+        ((frame_t *)slot)->id = i;
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_commit(&q));
+
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_acquire(&q, &read_slot));
+        TEST_ASSERT_EQUAL_UINT32(i, ((const frame_t *)read_slot)->id);
+        TEST_ASSERT_EQUAL(QUEUE_OK, queue_release(&q));
+    }
+}
+
+// Test NULL parameters are rejected
+TEST(queue_zero_copy, GivenNullParamsThenReturnsError)
+{
+    void *slot = NULL;
+    const void *read_slot = NULL;
+
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_reserve(NULL, &slot));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_reserve(&q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_commit(NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_acquire(NULL, &read_slot));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_acquire(&q, NULL));
+    TEST_ASSERT_EQUAL(QUEUE_ERROR, queue_release(NULL));
+}
\ No newline at end of file